@@ -0,0 +1,385 @@
+/*  -*- c++ -*-
+ *
+ * Time the MVA solvers on random networks.  Each model has M stations
+ * of the types given with -t, E entries per station and K chains with
+ * up to n customers each.  Open networks have no chains, mixed
+ * networks add an open class to every station that can take one (see
+ * generate()).  Linearizer2 has no mixed solution, so it is not run
+ * on mixed networks.  Service times, visits
+ * and populations are drawn from the seed, so a seed gives the same
+ * model to every solver.
+ *
+ * Each solver runs in its own process so that the peak memory
+ * (ru_maxrss) is that of the one solver.  The results are written to
+ * stdout as CSV:
+ *
+ *   network,M,K,E,N,types,seed,solver,seconds,steps,waits,maxrss_kb,status
+ *
+ * Not run by "make check"; use "make bench".
+ *
+ * ------------------------------------------------------------------------
+ * $Id$
+ * ------------------------------------------------------------------------
+ */
+
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <unistd.h>
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include "mva.h"
+#include "open.h"
+#include "server.h"
+#include "multserv.h"
+#include "pop.h"
+#include "vector.h"
+#include "fpgoop.h"
+
+enum class Network { CLOSED, OPEN, MIXED };
+
+static const char * network_name[] = { "closed", "open", "mixed" };
+
+static const char * stations[] = { "fcfs", "ps", "hvfcfs", "delay", "conway", "rolia", "rolia-ps", "reiser", "reiser-ps", "zhou", "bruell", "schmidt" };
+static const char * solvers[] = { "exact", "schweitzer", "linearizer", "linearizer2", "onestep" };
+
+struct Options {
+    Options() : network(Network::CLOSED), M(8), K(4), E(1), n(3), copies(4), seed(1), runs(3), limit(1000000),
+		types{ "fcfs", "ps", "hvfcfs", "delay" }, solvers{ "exact", "schweitzer", "linearizer", "linearizer2", "onestep" } {}
+    Network network;
+    unsigned M;				/* Stations.			*/
+    unsigned K;				/* Chains.			*/
+    unsigned E;				/* Entries per station.		*/
+    unsigned n;				/* Most customers per chain.	*/
+    unsigned copies;			/* Multiserver copies.		*/
+    unsigned seed;			/* First seed.			*/
+    unsigned runs;			/* Models (seeds) per solver.	*/
+    unsigned long limit;		/* Largest population for Exact	*/
+    std::vector<std::string> types;
+    std::vector<std::string> solvers;
+};
+
+/*
+ * What the child sends back to the parent.
+ */
+
+struct Result {
+    double seconds;
+    unsigned long steps;
+    unsigned long waits;
+    char status[64];
+};
+
+static double now()
+{
+    return std::chrono::duration<double>( std::chrono::steady_clock::now().time_since_epoch() ).count();
+}
+
+static double uniform( const double lo, const double hi )
+{
+    return lo + (hi - lo) * (rand() / (RAND_MAX + 1.0));
+}
+
+
+static std::vector<std::string>
+split( const std::string& arg, const char * const * valid, const size_t n_valid )
+{
+    std::vector<std::string> list;
+    std::istringstream input( arg );
+    std::string item;
+    while ( std::getline( input, item, ',' ) ) {
+	bool found = false;
+	for ( size_t i = 0; i < n_valid && !found; ++i ) {
+	    found = item == valid[i];
+	}
+	if ( !found ) {
+	    std::cerr << "Bogus name: " << item << std::endl;
+	    exit( 1 );
+	}
+	list.push_back( item );
+    }
+    if ( list.empty() ) {
+	std::cerr << "Empty list: " << arg << std::endl;
+	exit( 1 );
+    }
+    return list;
+}
+
+
+static Server *
+station( const std::string& type, const unsigned copies, const unsigned E, const unsigned K )
+{
+    if ( type == "fcfs" ) return new FCFS_Server( E, K );
+    else if ( type == "ps" ) return new PS_Server( E, K );
+    else if ( type == "hvfcfs" ) return new HVFCFS_Server( E, K );
+    else if ( type == "delay" ) return new Infinite_Server( E, K );
+    else if ( type == "conway" ) return new Conway_Multi_Server( copies, E, K );
+    else if ( type == "rolia" ) return new Rolia_Multi_Server( copies, E, K );
+    else if ( type == "rolia-ps" ) return new Rolia_PS_Multi_Server( copies, E, K );
+    else if ( type == "reiser" ) return new Reiser_Multi_Server( copies, E, K );
+    else if ( type == "reiser-ps" ) return new Reiser_PS_Multi_Server( copies, E, K );
+    else if ( type == "zhou" ) return new Zhou_Multi_Server( copies, E, K );
+    else if ( type == "bruell" ) return new Bruell_Multi_Server( copies, E, K );
+    else return new Schmidt_Multi_Server( copies, E, K );
+}
+
+
+/*
+ * Build the model for seed.  Station m is of type types[m % size].
+ * The open class, if any, loads each station to 30% of its capacity
+ * (all of its copies for the multiservers), so that it stays stable.
+ * Rolia and Zhou keep no marginal probabilities, which the mixed
+ * solution needs, so as in lqns, which uses Conway for servers with
+ * open arrivals, they only get the closed classes in a mixed network.
+ * The stations are indexed as the open and closed models index them.
+ */
+
+static void
+generate( const Options& o, const unsigned seed, Vector<Server *>& Q, Population& N, Vector<double>& Z, Vector<unsigned>& priority )
+{
+    const unsigned K = o.network == Network::OPEN ? 0 : o.K;
+
+    srand( seed );
+    N.resize( K );
+    Z.resize( K );
+    priority.resize( K );
+    for ( unsigned k = 1; k <= K; ++k ) {
+	N[k] = 1 + rand() % o.n;
+	Z[k] = uniform( 0.0, 10.0 );
+	priority[k] = 0;
+    }
+
+    Q.resize( o.M );
+    for ( unsigned m = 1; m <= o.M; ++m ) {
+	const std::string& type = o.types[(m - 1) % o.types.size()];
+	const bool open = o.network == Network::OPEN || ( o.network == Network::MIXED && type != "rolia" && type != "rolia-ps" && type != "zhou" );
+	Q[m] = station( type, o.copies, o.E, K );
+	Q[m]->openIndex = m;
+	Q[m]->closedIndex = o.network == Network::OPEN ? 0 : m;
+	for ( unsigned e = 1; e <= o.E; ++e ) {
+	    for ( unsigned k = 1; k <= K; ++k ) {
+		const double s = uniform( 0.1, 2.0 );
+		Q[m]->setService( e, k, 1, s ).setVisits( e, k, 1, 1 + rand() % 3 );
+		if ( Q[m]->hasVariance() ) {
+		    Q[m]->setVariance( e, k, 1, s * s * uniform( 0.25, 4.0 ) );
+		}
+	    }
+	    if ( open ) {
+		const double s = uniform( 0.1, 2.0 );
+		const double capacity = type == "fcfs" || type == "ps" || type == "hvfcfs" ? 1.0 : static_cast<double>(o.copies);
+		Q[m]->setService( e, 0, 1, s ).setVisits( e, 0, 1, 0.3 * capacity / (s * o.E) );
+		if ( Q[m]->hasVariance() ) {
+		    Q[m]->setVariance( e, 0, 1, s * s );
+		}
+	    }
+	}
+    }
+}
+
+
+static MVA *
+solver( const std::string& name, Vector<Server *>& Q, const Population& N, const Vector<double>& Z, const Vector<unsigned>& priority )
+{
+    if ( name == "exact" ) return new ExactMVA( Q, N, Z, priority );
+    else if ( name == "schweitzer" ) return new Schweitzer( Q, N, Z, priority );
+    else if ( name == "linearizer" ) return new Linearizer( Q, N, Z, priority );
+    else if ( name == "linearizer2" ) return new Linearizer2( Q, N, Z, priority );
+    else return new OneStepLinearizer( Q, N, Z, priority );
+}
+
+
+/*
+ * Solve one model.  Runs in the child.
+ */
+
+static void
+run( const Options& o, const unsigned seed, const std::string& name, Result& result )
+{
+    Vector<Server *> Q;
+    Population N;
+    Vector<double> Z;
+    Vector<unsigned> priority;
+
+    generate( o, seed, Q, N, Z, priority );
+    try {
+	const double start = now();
+	if ( o.network == Network::OPEN ) {
+	    Open model( Q );
+	    model.solve();
+	    result.seconds = now() - start;
+	} else {
+	    Open open( Q );
+	    if ( o.network == Network::MIXED ) open.convert( N );
+	    MVA * model = solver( name, Q, N, Z, priority );
+	    model->solve();
+	    if ( o.network == Network::MIXED ) open.solve( *model, N );
+	    result.seconds = now() - start;
+	    result.steps = model->iterations();
+	    result.waits = model->waits();
+	    delete model;
+	}
+	strcpy( result.status, "ok" );
+    }
+    catch ( const std::exception& error ) {
+	strncpy( result.status, error.what(), sizeof( result.status ) - 1 );
+	for ( char * p = result.status; *p; ++p ) {
+	    if ( *p == ',' || *p == '\n' ) *p = ' ';
+	}
+    }
+    for ( unsigned m = 1; m <= Q.size(); ++m ) {
+	delete Q[m];
+    }
+}
+
+
+/*
+ * Fork a child to solve the model and collect the result and its
+ * rusage.
+ */
+
+static void
+measure( const Options& o, const unsigned seed, const std::string& name )
+{
+    Vector<Server *> Q;
+    Population N;
+    Vector<double> Z;
+    Vector<unsigned> priority;
+    generate( o, seed, Q, N, Z, priority );
+    unsigned long total = 0;
+    double size = 1.0;
+    for ( unsigned k = 1; k <= N.size(); ++k ) {
+	total += N[k];
+	size *= N[k] + 1;
+    }
+    for ( unsigned m = 1; m <= Q.size(); ++m ) {
+	delete Q[m];
+    }
+
+    Result result = { 0.0, 0, 0, "" };
+    long maxrss = 0;
+    if ( name == "exact" && size > o.limit ) {
+	strcpy( result.status, "skipped" );
+    } else {
+	int fd[2];
+	if ( pipe( fd ) != 0 ) {
+	    perror( "pipe" );
+	    exit( 1 );
+	}
+	const pid_t pid = fork();
+	if ( pid < 0 ) {
+	    perror( "fork" );
+	    exit( 1 );
+	} else if ( pid == 0 ) {
+	    close( fd[0] );
+	    run( o, seed, name, result );
+	    const ssize_t count = write( fd[1], &result, sizeof( result ) );
+	    _exit( count == sizeof( result ) ? 0 : 1 );
+	}
+	close( fd[1] );
+	if ( read( fd[0], &result, sizeof( result ) ) != sizeof( result ) ) {
+	    strcpy( result.status, "failed" );
+	}
+	close( fd[0] );
+	int status = 0;
+	struct rusage usage;
+	if ( wait4( pid, &status, 0, &usage ) == pid ) {
+	    maxrss = usage.ru_maxrss;
+	    if ( WIFSIGNALED( status ) ) {
+		snprintf( result.status, sizeof( result.status ), "signal %d", WTERMSIG( status ) );
+	    }
+	}
+    }
+
+    std::string types;
+    for ( auto& type : o.types ) {
+	if ( !types.empty() ) types += "+";
+	types += type;
+    }
+    std::cout << network_name[static_cast<int>(o.network)] << ',' << o.M << ',' << (o.network == Network::OPEN ? 0 : o.K) << ',' << o.E << ','
+	      << total << ',' << types << ',' << seed << ',' << (o.network == Network::OPEN ? "open" : name.c_str()) << ','
+	      << result.seconds << ',' << result.steps << ',' << result.waits << ',' << maxrss << ',' << result.status << std::endl;
+}
+
+
+static unsigned
+number( const char * arg, const unsigned lo, const char * what )
+{
+    char * end;
+    const unsigned long value = strtoul( arg, &end, 10 );
+    if ( *end != '\0' || value < lo ) {
+	std::cerr << "Bogus " << what << ": " << arg << std::endl;
+	exit( 1 );
+    }
+    return value;
+}
+
+
+static void
+usage( const char * name )
+{
+    std::cerr << "Usage: " << name << " [-q] [-x closed|open|mixed] [-m stations] [-k chains] [-e entries] [-n customers]" << std::endl
+	      << "       [-c copies] [-r runs] [-S seed] [-L limit] [-t type,...] [-s solver,...]" << std::endl
+	      << "Types:  ";
+    for ( auto type : stations ) std::cerr << " " << type;
+    std::cerr << std::endl << "Solvers:";
+    for ( auto name : solvers ) std::cerr << " " << name;
+    std::cerr << std::endl;
+    exit( 1 );
+}
+
+
+int
+main( int argc, char *argv[] )
+{
+    Options o;
+    bool header = true;
+    int c;
+
+    while (( c = getopt( argc, argv, "c:e:k:L:m:n:qr:s:S:t:x:" )) != EOF) {
+	switch( c ) {
+	case 'c': o.copies = number( optarg, 1, "copies" ); break;
+	case 'e': o.E = number( optarg, 1, "entry count" ); break;
+	case 'k': o.K = number( optarg, 1, "chain count" ); break;
+	case 'L': o.limit = number( optarg, 1, "limit" ); break;
+	case 'm': o.M = number( optarg, 1, "station count" ); break;
+	case 'n': o.n = number( optarg, 1, "customer count" ); break;
+	case 'q': header = false; break;
+	case 'r': o.runs = number( optarg, 1, "run count" ); break;
+	case 's': o.solvers = split( optarg, solvers, sizeof( solvers ) / sizeof( solvers[0] ) ); break;
+	case 'S': o.seed = number( optarg, 0, "seed" ); break;
+	case 't': o.types = split( optarg, stations, sizeof( stations ) / sizeof( stations[0] ) ); break;
+
+	case 'x':
+	    if ( strcmp( optarg, "closed" ) == 0 ) o.network = Network::CLOSED;
+	    else if ( strcmp( optarg, "open" ) == 0 ) o.network = Network::OPEN;
+	    else if ( strcmp( optarg, "mixed" ) == 0 ) o.network = Network::MIXED;
+	    else usage( argv[0] );
+	    break;
+
+	default:
+	    usage( argv[0] );
+	}
+    }
+    if ( optind != argc ) usage( argv[0] );
+
+    set_fp_abort();
+    if ( header ) {
+	std::cout << "network,M,K,E,N,types,seed,solver,seconds,steps,waits,maxrss_kb,status" << std::endl;
+    }
+    for ( unsigned seed = o.seed; seed < o.seed + o.runs; ++seed ) {
+	if ( o.network == Network::OPEN ) {
+	    measure( o, seed, "open" );
+	} else {
+	    for ( auto& name : o.solvers ) {
+		if ( o.network == Network::MIXED && name == "linearizer2" ) continue;
+		measure( o, seed, name );
+	    }
+	}
+    }
+    return 0;
+}
@@ -82,7 +82,7 @@ int main ( int argc, char * argv[] )
 	switch ( type ) {
 	case A_POP:
 	    aServer = new Conway_Multi_Server( m );
-	    next = new Conway_Multi_Server::A_Iterator( *aServer, j, NCust, 0 );
+	    next = &(new Conway_Multi_Server::A_Iterator( *aServer, NCust, 0 ))->restart( j );
 	    break;
 
 	case B_POP:
@@ -20,19 +20,19 @@ char * myName;
 
 static void usage ()
 {
-    std::cerr << myName << " [-[els]] n1 n2 n3 ... " << std::endl;
+    std::cerr << myName << " [-[elsv]] n1 n2 n3 ... " << std::endl;
     exit( 1 );
 }
 
 int main ( int argc, char * argv[] )
 {
-    typedef enum { EXACT, LINEARIZER, SCHWEITZER } test_case_t;
+    typedef enum { EXACT, LINEARIZER, SCHWEITZER, VECTOR } test_case_t;
     std::set<test_case_t> test_case;
 
     myName = argv[0];
 	
     for ( ;; ) {
-	const int c = getopt( argc, argv, "els" );
+	const int c = getopt( argc, argv, "elsv" );
 	if ( c == EOF) break;
 	
 	switch ( c ) {
@@ -48,6 +48,10 @@ int main ( int argc, char * argv[] )
 	    test_case.insert( SCHWEITZER );
 	    break;
 
+	case 'v':
+	    test_case.insert( VECTOR );
+	    break;
+
 	default:
 	    std::cerr << "Unkown option." << std::endl;
 	    usage();
@@ -72,5 +76,60 @@ int main ( int argc, char * argv[] )
 
     /* Iterate over all populations. */
 
-    return 0;
+    int rc = 0;
+    if ( test_case.find( EXACT ) != test_case.end() ) {
+	LevelPopulationMap map( N );
+	size_t count = 0;
+	for ( unsigned l = 0; l <= map.levels(); ++l ) {
+	    std::set<unsigned> used;
+	    for ( size_t i = 0; i < map.size( l ); ++i ) {
+		const Population I = map.population( l, i );
+		const unsigned n = map.offset( I );
+		if ( I.sum() != l || n >= map.maxOffset() || !used.insert( n ).second ) {
+		    std::cerr << "Bad offset " << n << " for " << I << std::endl;
+		    rc = 1;
+		}
+		for ( unsigned j = 1; j <= k; ++j ) {
+		    if ( I[j] == 0 ) continue;
+		    Population I_j = I;
+		    I_j[j] -= 1;
+		    if ( map.offset_e_j( I, j ) != map.offset( I_j ) ) {
+			std::cerr << "Bad offset_e_j for " << I << ", j=" << j << std::endl;
+			rc = 1;
+		    }
+		}
+		count += 1;
+	    }
+	}
+	std::cout << "Levels: " << map.levels() + 1 << ", populations: " << count << ", storage: " << map.maxOffset() << std::endl;
+    }
+
+    /* Copy and move, both inline and on the heap. */
+
+    if ( test_case.find( VECTOR ) != test_case.end() ) {
+	for ( unsigned extra = 0; extra <= 8; extra += 8 ) {
+	    Population A( N );
+	    A.resize( k + extra );
+	    const Population B( A );
+	    Population C( std::move( A ) );
+	    Population D;
+	    D = std::move( C );
+	    Population E( 1 );
+	    E = D;
+	    if ( !(D == B) || !(E == B) || A.size() != 0 || C.size() != 0 ) {
+		std::cerr << "Bad copy or move of " << B << std::endl;
+		rc = 1;
+	    }
+	    for ( unsigned j = 1; j <= k + extra; ++j ) {
+		if ( D[j] != (j <= k ? N[j] : 0) ) {
+		    std::cerr << "Bad resize of " << D << std::endl;
+		    rc = 1;
+		    break;
+		}
+	    }
+	}
+	std::cout << "Vector: " << (rc == 0 ? "ok" : "failed") << std::endl;
+    }
+
+    return rc;
 }
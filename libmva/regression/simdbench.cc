@@ -0,0 +1,211 @@
+/*  -*- c++ -*-
+ *
+ * Time the sumOf kernels for each instruction set supported by the
+ * processor.  The first table times the kernels alone on rows of K
+ * classes and E entries.  The second solves a model with K chains
+ * using Bard-Schweitzer and reports the time and the largest
+ * difference in throughput from the in-order (serial) sums used by
+ * default.  The scalar and vector kernels all sum in the same order, so
+ * they differ from serial in the last bits, but not from each other.
+ *
+ * Not run by "make check"; use "make bench".
+ *
+ * ------------------------------------------------------------------------
+ * $Id$
+ * ------------------------------------------------------------------------
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+#include <unistd.h>
+#include "mva.h"
+#include "server.h"
+#include "simd.h"
+#include "pop.h"
+#include "vector.h"
+#include "fpgoop.h"
+
+static const SIMD::ISA isas[] = { SIMD::ISA::SERIAL, SIMD::ISA::SCALAR, SIMD::ISA::SSE2, SIMD::ISA::AVX2 };
+static const unsigned classes[] = { 8, 16, 32, 64, 128 };
+
+static double now()
+{
+    return std::chrono::duration<double>( std::chrono::steady_clock::now().time_since_epoch() ).count();
+}
+
+
+/*
+ * Nanoseconds per call of sum, dot and dot3 on a row of n doubles.
+ */
+
+static void
+kernels( const unsigned E, const unsigned long count )
+{
+    std::cout << "Kernels, E=" << E << " (ns/call: sum dot dot3)" << std::endl;
+    std::cout << std::setw(6) << "K";
+    for ( auto isa : isas ) {
+	if ( SIMD::supports( isa ) ) std::cout << std::setw(27) << SIMD::name( isa );
+    }
+    std::cout << std::endl;
+
+    for ( auto K : classes ) {
+	const size_t n = K * E;
+	std::vector<double> x( n ), y( n ), z( n );
+	for ( size_t i = 0; i < n; ++i ) {
+	    x[i] = 1.0 / (i + 1);
+	    y[i] = 0.5 + i % 7;
+	    z[i] = 1.0 - 1.0 / (i + 2);
+	}
+
+	std::cout << std::setw(6) << K;
+	for ( auto isa : isas ) {
+	    if ( !SIMD::supports( isa ) ) continue;
+	    const SIMD::Kernels& f = SIMD::kernels( isa );
+	    volatile double sink = 0.0;
+	    double t[3];
+	    double start = now();
+	    for ( unsigned long i = 0; i < count; ++i ) sink = sink + f.sum( x.data(), n );
+	    t[0] = now() - start;
+	    start = now();
+	    for ( unsigned long i = 0; i < count; ++i ) sink = sink + f.dot( x.data(), y.data(), n );
+	    t[1] = now() - start;
+	    start = now();
+	    for ( unsigned long i = 0; i < count; ++i ) sink = sink + f.dot3( x.data(), y.data(), z.data(), n );
+	    t[2] = now() - start;
+	    std::cout << std::fixed << std::setprecision(1);
+	    for ( unsigned i = 0; i < 3; ++i ) {
+		std::cout << std::setw(9) << t[i] * 1.0e9 / count;
+	    }
+	}
+	std::cout << std::endl;
+    }
+    std::cout << std::endl;
+}
+
+
+/*
+ * Solve a model of K chains visiting M queues and a delay.  Service
+ * times are fixed by the seed so each instruction set sees the same
+ * model.
+ */
+
+static double
+solve( const unsigned K, const unsigned M, const unsigned E, std::vector<double>& X )
+{
+    Population N( K );
+    Vector<double> Z( K );
+    Vector<unsigned> priority( K );
+    Vector<Server *> Q( M );
+
+    srand( 1 );
+    for ( unsigned k = 1; k <= K; ++k ) {
+	N[k] = 1 + rand() % 3;
+	Z[k] = 1 + rand() % 10;
+	priority[k] = 0;
+    }
+    for ( unsigned m = 1; m <= M; ++m ) {
+	if ( m == M ) {
+	    Q[m] = new Infinite_Server( E, K );
+	} else {
+	    Q[m] = new FCFS_Server( E, K );
+	}
+	for ( unsigned e = 1; e <= E; ++e ) {
+	    for ( unsigned k = 1; k <= K; ++k ) {
+		Q[m]->setService( e, k, 0.1 + (rand() % 100) / 50.0 );
+		Q[m]->setVisits( e, k, 1 + rand() % 3 );
+	    }
+	}
+    }
+
+    Schweitzer model( Q, N, Z, priority );
+    const double start = now();
+    model.solve();
+    const double elapsed = now() - start;
+
+    X.resize( K + 1 );
+    for ( unsigned k = 1; k <= K; ++k ) {
+	X[k] = model.throughput( k );
+    }
+    for ( unsigned m = 1; m <= M; ++m ) {
+	delete Q[m];
+    }
+    return elapsed;
+}
+
+
+static void
+models( const unsigned M, const unsigned E )
+{
+    std::cout << "Bard-Schweitzer, M=" << M << ", E=" << E << " (ms, max |dX|/X vs serial)" << std::endl;
+    std::cout << std::setw(6) << "K";
+    for ( auto isa : isas ) {
+	if ( SIMD::supports( isa ) ) std::cout << std::setw(22) << SIMD::name( isa );
+    }
+    std::cout << std::endl;
+
+    for ( auto K : classes ) {
+	std::vector<double> X0;
+	std::cout << std::setw(6) << K;
+	for ( auto isa : isas ) {
+	    if ( !SIMD::supports( isa ) ) continue;
+	    SIMD::setISA( isa );
+	    std::vector<double> X;
+	    const double elapsed = solve( K, M, E, X );
+	    if ( isa == SIMD::ISA::SERIAL ) X0 = X;
+	    double diff = 0.0;
+	    for ( unsigned k = 1; k <= K; ++k ) {
+		diff = std::max( diff, std::fabs( X[k] - X0[k] ) / X0[k] );
+	    }
+	    std::cout << std::fixed << std::setprecision(2) << std::setw(10) << elapsed * 1000.0
+		      << std::scientific << std::setprecision(2) << std::setw(12) << diff;
+	}
+	std::cout << std::endl;
+    }
+    SIMD::setISA( SIMD::ISA::SERIAL );
+    std::cout << std::endl;
+}
+
+
+int
+main( int argc, char *argv[] )
+{
+    unsigned long count = 1000000;
+    unsigned M = 8;
+    int c;
+
+    while (( c = getopt( argc, argv, "m:n:" )) != EOF) {
+	switch( c ) {
+	case 'm':
+	    M = atoi( optarg );
+	    if ( M < 2 ) {
+		std::cerr << "Bogus station count: " << optarg << std::endl;
+		exit( 1 );
+	    }
+	    break;
+
+	case 'n':
+	    count = atol( optarg );
+	    if ( count == 0 ) {
+		std::cerr << "Bogus loop count: " << optarg << std::endl;
+		exit( 1 );
+	    }
+	    break;
+
+	default:
+	    std::cerr << "Usage: " << argv[0] << " [-m stations] [-n count]" << std::endl;
+	    exit( 1 );
+	}
+    }
+
+    std::cout << "Default: " << SIMD::name( SIMD::isa() ) << ", best: " << SIMD::name( SIMD::best() ) << std::endl << std::endl;
+    kernels( 1, count );
+    kernels( 4, count / 4 );
+    models( M, 1 );
+    models( M, 4 );
+    return 0;
+}
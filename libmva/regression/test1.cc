@@ -70,7 +70,7 @@ check( const int solverId, const MVA& solver, const unsigned )
     const unsigned n = solver.offset(solver.NCust);			/* Hoist */
     for ( unsigned m = 1; m <= solver.M; ++m ) {
 	for ( unsigned k = 1; k <= solver.K; ++k ) {
-	    if ( fabs( solver.L[n][m][1][k] - goodL[solverId][m][k] ) >= 0.001 ) {
+	    if ( fabs( solver.L[n][m][1][k] - goodL[solverId][m][k] ) >= check_tolerance ) {
 		std::cerr << "Mismatch at m=" << m <<", k=" << k;
 		std::cerr << ".  Computed=" << solver.L[n][m][1][k] << ", Correct= " << goodL[solverId][m][k] << std::endl;
 		ok = false;
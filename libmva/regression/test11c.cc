@@ -0,0 +1,75 @@
+/*  -*- c++ -*-
+ * $HeadURL: http://rads-svn.sce.carleton.ca:8080/svn/lqn/trunk-V5/libmva/regression/test11c.cc $
+ *
+ * Priority MVA, three classes at three priorities.  priorityInflation()
+ * reads populations more than one level down, so Exact MVA must not
+ * solve it level by level.
+ *
+ * ------------------------------------------------------------------------
+ * $Id: test11c.cc 15384 2022-01-25 02:56:14Z greg $
+ * ------------------------------------------------------------------------
+ */
+
+#include <cmath>
+#include "testmva.h"
+#include "server.h"
+#include "pop.h"
+#include "mva.h"
+
+void
+test( Population& NCust, Vector<Server *>& Q, VectorMath<double>& Z, VectorMath<unsigned>& priority, const unsigned )
+{
+    const unsigned classes  = 3;
+    const unsigned stations = 2;
+
+    NCust.resize(classes);			/* Population vector.		*/
+    Z.resize(classes);			/* Think times.			*/
+    priority.resize(classes);
+    Q.resize(stations);			/* Queue type.  SS/delay.	*/
+
+    NCust[1] = 6;	NCust[2] = 3;	NCust[3] = 2;
+    Z[1] = 0.0;	Z[2] = 0.0;	Z[3] = 0.0;
+    priority[1] = 2;priority[2] = 1;priority[3] = 0;
+
+    Q[1] = new Infinite_Server(classes);
+    Q[2] = new PR_FCFS_Server(classes);
+
+    for ( unsigned k = 1; k <= classes; ++k ) {
+	Q[1]->setService(k,8.0).setVisits(k,1.0);
+	Q[2]->setService(k,1.0).setVisits(k,1.0);
+    }
+}
+
+
+void
+special_check( std::ostream&, const MVA&, const unsigned )
+{
+}
+
+
+
+static double goodL[4][3][4] = {
+    { { 0, 0, 0, 0 }, { 0, 4.882, 1.727, 0.8407 }, { 0, 1.118, 1.273, 1.159 } },	// Exact MVA
+    { { 0, 0, 0, 0 }, { 0, 4.886, 1.85,  0.9672 }, { 0, 1.114, 1.15,  1.033 } },	// Linearizer
+    { { 0, 0, 0, 0 }, { 0, 3.771, 1.723, 1.077 },  { 0, 2.229, 1.277, 0.9233 } },	// Fast Linearizer
+    { { 0, 0, 0, 0 }, { 0, 4.801, 1.732, 0.879 },  { 0, 1.199, 1.268, 1.121 } },	// Bard Schweitzer
+};
+
+bool
+check( const int solverId, const MVA& solver, const unsigned )
+{
+    bool ok = true;
+
+    unsigned n = solver.offset(solver.NCust);
+    for ( unsigned m = 1; m <= solver.M; ++m ) {
+	for ( unsigned k = 1; k <= solver.K; ++k ) {
+	    if ( fabs( solver.L[n][m][1][k] - goodL[solverId][m][k] ) >= check_tolerance ) {
+		std::cerr << "Mismatch at m=" << m <<", k=" << k;
+		std::cerr << ".  Computed=" << solver.L[n][m][1][k] << ", Correct= " << goodL[solverId][m][k] << std::endl;
+		ok = false;
+	    }
+	}
+    }
+    return ok;
+}
+
@@ -164,7 +164,7 @@ check( const int solverId, const MVA & solver, const unsigned s5k_ix )
 	    } else {
 		e = 1;
 	    }
-	    if ( fabs( solver.L[n][m][e][k] - goodL[s5k_ix][solverId][m][k] ) >= 0.001 ) {
+	    if ( fabs( solver.L[n][m][e][k] - goodL[s5k_ix][solverId][m][k] ) >= check_tolerance ) {
 		std::cerr << "Mismatch at m=" << m <<", k=" << k;
 		std::cerr << ".  Computed=" << solver.L[n][m][e][k] << ", Correct= " << goodL[s5k_ix][solverId][m][k] << std::endl;
 		ok = false;
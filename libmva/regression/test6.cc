@@ -95,7 +95,7 @@ check( const int solverId, const MVA & solver, const unsigned )
 	    } else {
 		e = k;
 	    }
-	    if ( fabs( solver.L[n][m][e][k] - goodL[solverId][m][k] ) >= 0.001 ) {
+	    if ( fabs( solver.L[n][m][e][k] - goodL[solverId][m][k] ) >= check_tolerance ) {
 		std::cerr << "Mismatch at m=" << m <<", k=" << k;
 		std::cerr << ".  Computed=" << solver.L[n][m][e][k] << ", Correct= " << goodL[solverId][m][k] << std::endl;
 		ok = false;
@@ -120,7 +120,7 @@ check( const int solverId, const MVA & solver, const unsigned v22_ix )
 			} else {
 				e = 1;
 			}
-			if ( fabs( solver.L[n][m][e][k] - goodL[v22_ix][solverId][m][k] ) >= 0.001 ) {
+			if ( fabs( solver.L[n][m][e][k] - goodL[v22_ix][solverId][m][k] ) >= check_tolerance ) {
 				std::cerr << "Mismatch at m=" << m <<", k=" << k;
 				std::cerr << ".  Computed=" << solver.L[n][m][e][k] << ", Correct= " << goodL[v22_ix][solverId][m][k] << std::endl;
 				ok = false;
@@ -339,5 +339,5 @@ void
 special_check( std::ostream& output, const MVA& solver, const unsigned )
 {
     output << ": X = " << std::setw(4) << solver.throughput(1)
-	   << ", U" << std::setw(4) << solver.U[2][1][1];
+	   << ", U" << std::setw(4) << solver.U[solver.offset(solver.NCust)][2][1][1];
 }
@@ -28,6 +28,7 @@
 #include <getopt.h>
 #include "prob.h"
 #include "fpgoop.h"
+#include "multserv.h"
 #include "mvaexception.h"
 
 static bool doIt( const solverId, Vector<Server *>& Q, const Population & NCust, const VectorMath<double>& thinkTime, const VectorMath<unsigned>& priority, const unsigned special );
@@ -40,16 +41,20 @@ const struct option longopts[] =
     /* name */ /* has arg */ /*flag */ /* val */
 {
     { "all",             no_argument,       0, 'a' },
+    { "anderson",        required_argument, 0, 'A' },
     { "bard-schweitzer", no_argument,       0, 'b' },
+    { "conway-limit",    required_argument, 0, 'c' },
     { "debug-mva",	 no_argument,	    0, 'd' },
     { "exact-mva",       no_argument,       0, 'e' },
     { "fast-linearizer", no_argument,       0, 'f' },
     { "help",            no_argument,       0, 'h' },
     { "iterations",      required_argument, 0, 'i' },
+    { "jobs",            required_argument, 0, 'j' },
     { "linearizer",      no_argument,       0, 'l' },
     { "no-check",        no_argument,       0, 'n' },
     { "print",           no_argument,       0, 'p' },
     { "silent",          no_argument,       0, 's' },
+    { "statistics",      no_argument,       0, 'S' },
     { "test-number",     required_argument, 0, 't' },
     { "verbose",         no_argument,       0, 'v' },
     { 0, 0, 0, 0 }
@@ -57,19 +62,23 @@ const struct option longopts[] =
 #else
 #warning No getopt_long
 #endif
-const char opts[]	= "abdefhi:lnpst:v";
+const char opts[]	= "aA:bc:defhi:j:lnpsSt:v";
 const char * opthelp[]  = {
     /* "all",             */    "Test using all MVA solvers.",
+    /* "anderson",        */    "Use Anderson acceleration with a history of ARG iterations for Bard-Schweitzer and Linearizer.  The results are checked to 0.02 rather than 0.001.",
     /* "bard-schweitzer", */    "Test using Bard-Schweitzer solver.",
+    /* "conway-limit",    */    "Use the Rolia multiserver instead of Conway when there are more than ARG populations to sum over.",
     /* "debug",           */    "Enable debug code.",
     /* "exact-mva",       */    "Test using Exact MVA solver.",
     /* "fast-linearizer", */    "Test using the Fast Linearizer solver.",
     /* "help",            */    "Show this.",
     /* "iterations",      */    "Run the test ARG times.",
+    /* "jobs",            */    "Solve the reduced populations of Linearizer using ARG threads (0 for all cores).",
     /* "linearizer",      */    "Test using Generic Linearizer.",
     /* "no-check",        */    "Do not check solution against \"correct\" values.",
     /* "print"		  */	"Print out station info.",
     /* "silent",          */    "",
+    /* "statistics",      */    "Print the statistics kept by each station (the Conway table cache).",
     /* "test",            */    "Select test ARG.  Arg is an integer.",
     /* "verbose",         */    "",
     0
@@ -78,10 +87,22 @@ const char * opthelp[]  = {
 /* -- */
 
 static int silencio_flag = 0;			/* Don't print results if 1	*/
-static int verbose_flag = 0;			/* Print iteration count if 1	*/
+static int verbose_flag = 0;			/* Print iterations and tables if 1 */
 static int print_flag = 0;			/* Print station info.		*/
+static int statistics_flag = 0;			/* Print station statistics.	*/
 static int nocheck_flag = 0;			/* Don't check if 1.		*/
 
+/*
+ * The correct answers for the approximate solvers were found by plain
+ * substitution, which stops once no queue length moves by more than
+ * the termination test.  Anderson acceleration stops nearer to the
+ * fixed point, up to 0.013 away from those answers (test2), so its
+ * runs are checked more loosely.
+ */
+
+double check_tolerance = 0.001;
+static const double anderson_tolerance = 0.02;
+
 
 /*
  * Main line.
@@ -111,10 +132,27 @@ int main (int argc, char *argv[])
 	    solver_set = EXACT_SOLVER_BIT|BARD_SCHWEITZER_SOLVER_BIT|LINEARIZER_SOLVER_BIT;
 	    break;
 			
+	case 'A':
+	    if ( sscanf( optarg, "%u", &MVA::__anderson ) != 1 ) {
+		std::cerr << "Bogus Anderson depth: " << optarg << std::endl;
+		exit( 1 );
+	    }
+	    if ( MVA::__anderson > 0 ) {
+		check_tolerance = anderson_tolerance;
+	    }
+	    break;
+
 	case 'b':
 	    solver_set |= BARD_SCHWEITZER_SOLVER_BIT;
 	    break;
 
+	case 'c':
+	    if ( sscanf( optarg, "%lu", &Conway_Multi_Server::__max_populations ) != 1 ) {
+		std::cerr << "Bogus population limit: " << optarg << std::endl;
+		exit( 1 );
+	    }
+	    break;
+
 	case 'd':
 	    MVA::debug_D = true;
 	    MVA::debug_L = true;
@@ -142,6 +180,13 @@ int main (int argc, char *argv[])
 	    }
 	    break;
 			
+	case 'j':
+	    if ( sscanf( optarg, "%u", &MVA::__threads ) != 1 ) {
+		std::cerr << "Bogus thread count: " << optarg << std::endl;
+		exit( 1 );
+	    }
+	    break;
+
 	case 'l':
 	    solver_set |= LINEARIZER_SOLVER_BIT;
 	    break;
@@ -158,6 +203,10 @@ int main (int argc, char *argv[])
 	    silencio_flag = 1;
 	    break;
 
+	case 'S':
+	    statistics_flag = 1;
+	    break;
+
 	case 't':
 	    if ( sscanf( optarg, "%u", &special ) != 1 ) {
 		std::cerr << "Bogus \"special\": " << optarg << std::endl;
@@ -303,6 +352,11 @@ doIt( solverId solver, Vector<Server *>& Q, const Population & N, const VectorMa
 	if ( verbose_flag ) {
 	    std::cout << "Number of iterations of core step: " << model->iterations() << std::endl;
 	}
+	if ( statistics_flag ) {
+	    for ( unsigned m = 1; m <= Q.size(); ++m ) {
+		Q[m]->printStatistics( std::cout, m );
+	    }
+	}
 
 	if ( !nocheck_flag ) {
 	    ok = check( (int)solver, *model, special );
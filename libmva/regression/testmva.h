@@ -34,6 +34,8 @@ typedef enum {EXACT_SOLVER, LINEARIZER_SOLVER, LINEARIZER2_SOLVER, BARD_SCHWEITZ
 
 /* linearizer.c */
 
+extern double check_tolerance;		/* Largest |L - goodL| accepted by check().	*/
+
 int main(int argc, char *argv[]);
 void special_check( std::ostream&, const MVA&, const unsigned );
 void test( Population&, Vector<Server *>&, VectorMath<double>&, VectorMath<unsigned>&, const unsigned );
@@ -0,0 +1,160 @@
+/*  -*- c++ -*-
+ * $Id$
+ *
+ * Anderson mixing.  See Walker and Ni, "Anderson acceleration for
+ * fixed-point iterations", SIAM J. Numer. Anal. 49(4), 2011.
+ *
+ * Copyright the Real-Time and Distributed Systems Group,
+ * Department of Systems and Computer Engineering,
+ * Carleton University, Ottawa, Ontario, Canada. K1S 5B6
+ *
+ * October 2026
+ *
+ * ------------------------------------------------------------------------
+ */
+
+#include <algorithm>
+#include <cmath>
+#include "anderson.h"
+
+/*
+ * Start over with depth differences.
+ */
+
+void
+Anderson::reset( const unsigned depth )
+{
+    _depth = depth;
+    _dF.clear();
+    _dG.clear();
+    _f.clear();
+    _g.clear();
+    _norm = 0.0;
+}
+
+
+
+/*
+ * Drop the differences, but keep the last point as the base for the
+ * next ones.  Always false so it can be returned by mix().
+ */
+
+bool
+Anderson::restart()
+{
+    _dF.clear();
+    _dG.clear();
+    return false;
+}
+
+
+
+/*
+ * Mix g = G(x).  Returns true if g was replaced.
+ */
+
+bool
+Anderson::mix( const std::vector<double>& x, std::vector<double>& g )
+{
+    const size_t n = x.size();
+    std::vector<double> f( n );
+    double norm = 0.0;
+    for ( size_t i = 0; i < n; ++i ) {
+	f[i] = g[i] - x[i];
+	norm += f[i] * f[i];
+    }
+    norm = std::sqrt( norm );
+    if ( _depth == 0 || !std::isfinite( norm ) ) {
+	_f.clear();
+	_g.clear();
+	return restart();
+    }
+
+    /* Save the differences from the last point */
+
+    const bool growing = !_f.empty() && norm > 2.0 * _norm;
+    if ( !_f.empty() && _f.size() == n ) {
+	std::vector<double> df( n );
+	std::vector<double> dg( n );
+	for ( size_t i = 0; i < n; ++i ) {
+	    df[i] = f[i] - _f[i];
+	    dg[i] = g[i] - _g[i];
+	}
+	_dF.push_back( df );
+	_dG.push_back( dg );
+	if ( _dF.size() > _depth ) {
+	    _dF.pop_front();
+	    _dG.pop_front();
+	}
+    }
+    _f = f;
+    _g = g;
+    _norm = norm;
+    if ( growing ) return restart();
+    const size_t m = _dF.size();
+    if ( m == 0 ) return false;
+
+    /* Normal equations (dF'dF) gamma = dF'f, Tikhonov regularized. */
+
+    std::vector<std::vector<double> > A( m, std::vector<double>( m + 1, 0.0 ) );
+    double scale = 0.0;
+    for ( size_t r = 0; r < m; ++r ) {
+	for ( size_t c = 0; c <= r; ++c ) {
+	    double sum = 0.0;
+	    for ( size_t i = 0; i < n; ++i ) {
+		sum += _dF[r][i] * _dF[c][i];
+	    }
+	    A[r][c] = sum;
+	    A[c][r] = sum;
+	}
+	double sum = 0.0;
+	for ( size_t i = 0; i < n; ++i ) {
+	    sum += _dF[r][i] * f[i];
+	}
+	A[r][m] = sum;
+	scale = std::max( scale, A[r][r] );
+    }
+    if ( scale <= 0.0 ) return restart();
+    for ( size_t r = 0; r < m; ++r ) {
+	A[r][r] += 1.0e-10 * scale;
+    }
+
+    /* Gaussian elimination with partial pivoting. */
+
+    for ( size_t c = 0; c < m; ++c ) {
+	size_t p = c;
+	for ( size_t r = c + 1; r < m; ++r ) {
+	    if ( std::fabs( A[r][c] ) > std::fabs( A[p][c] ) ) p = r;
+	}
+	if ( std::fabs( A[p][c] ) <= 1.0e-14 * scale ) return restart();
+	std::swap( A[c], A[p] );
+	for ( size_t r = c + 1; r < m; ++r ) {
+	    const double factor = A[r][c] / A[c][c];
+	    for ( size_t j = c; j <= m; ++j ) {
+		A[r][j] -= factor * A[c][j];
+	    }
+	}
+    }
+    std::vector<double> gamma( m );
+    for ( size_t r = m; r-- > 0; ) {
+	double sum = A[r][m];
+	for ( size_t j = r + 1; j < m; ++j ) {
+	    sum -= A[r][j] * gamma[j];
+	}
+	gamma[r] = sum / A[r][r];
+    }
+
+    /* x' = g - dG gamma.  Queue lengths can't be negative. */
+
+    std::vector<double> y( g );
+    for ( size_t r = 0; r < m; ++r ) {
+	for ( size_t i = 0; i < n; ++i ) {
+	    y[i] -= gamma[r] * _dG[r][i];
+	}
+    }
+    for ( size_t i = 0; i < n; ++i ) {
+	if ( !std::isfinite( y[i] ) || y[i] < 0.0 ) return restart();
+    }
+    g = y;
+    return true;
+}
@@ -0,0 +1,188 @@
+/*  -*- c++ -*-
+ * $Id$
+ *
+ * Contiguous storage for the per-population arrays of the MVA solvers.
+ *
+ * Copyright the Real-Time and Distributed Systems Group,
+ * Department of Systems and Computer Engineering,
+ * Carleton University, Ottawa, Ontario, Canada. K1S 5B6
+ *
+ * October 2026
+ *
+ * ------------------------------------------------------------------------
+ */
+
+#include <algorithm>
+#include <new>
+#include "arena.h"
+#include "server.h"
+
+/*
+ * Set the number of records to size, each holding count doubles.  The
+ * new block is zero filled and is the only allocation made.  Records
+ * are kept if their layout does not change.
+ */
+
+void
+Arena::resize( const size_t size, const size_t count )
+{
+    const size_t line = alignment / sizeof(double);
+    const size_t stride = ((count + line - 1) / line) * line;
+    if ( size == _size && stride == _stride ) return;
+
+    std::shared_ptr<double> block;
+    if ( size * stride > 0 ) {
+	block.reset( static_cast<double *>(::operator new( size * stride * sizeof(double), std::align_val_t(alignment) )),
+		     []( double * p ){ ::operator delete( p, std::align_val_t(alignment) ); } );
+	std::fill( block.get(), block.get() + size * stride, 0.0 );
+	if ( stride == _stride && _size > 0 ) {
+	    std::copy( _block.get(), _block.get() + std::min( size, _size ) * stride, block.get() );
+	}
+    }
+    _block = block;
+    _size = size;
+    _stride = stride;
+}
+
+
+
+/*
+ * Release our hold on the block.
+ */
+
+void
+Arena::clear()
+{
+    _block.reset();
+    _size = 0;
+    _stride = 0;
+}
+
+
+
+/*
+ * Set every element to value.
+ */
+
+void
+Arena::fill( const double value )
+{
+    std::fill( _block.get(), _block.get() + _size * _stride, value );
+}
+
+/* -------------------------------------------------------------------- */
+
+/*
+ * Allocate size records for the stations in Q and K classes.
+ */
+
+void
+N_m_e_k::dimension( const size_t size, const Vector<Server *>& Q, const unsigned K )
+{
+    const unsigned M = Q.size();
+    std::vector<size_t> offset( M + 1, 0 );
+    std::vector<unsigned> E( M + 1, 0 );
+
+    size_t count = 0;
+    for ( unsigned m = 1; m <= M; ++m ) {
+	offset[m] = count;
+	E[m] = Q[m]->nEntries();
+	count += (K + 1) * E[m];
+    }
+
+    if ( offset != _offset || E != _E ) {
+	_arena.clear();			/* Layout changed. */
+	_offset = offset;
+	_E = E;
+    }
+    _arena.resize( size, count );
+}
+
+
+void
+N_m_e_k::clear()
+{
+    _arena.clear();
+    _offset.clear();
+    _E.clear();
+}
+
+/* -------------------------------------------------------------------- */
+
+/*
+ * Allocate size records for the marginal probabilities of the
+ * stations in Q.  The marginals of stations whose size did not change
+ * are kept; the others start with no servers busy.  Returns true if
+ * any marginals were (re)initialized or removed.
+ */
+
+bool
+N_m_j::dimension( const size_t size, const Vector<Server *>& Q )
+{
+    const unsigned M = Q.size();
+    std::vector<size_t> offset( M + 1, 0 );
+    std::vector<unsigned> J( M + 1, 0 );
+
+    size_t count = 0;
+    for ( unsigned m = 1; m <= M; ++m ) {
+	offset[m] = count;
+	J[m] = Q[m]->getMarginalProbabilitiesSize();
+	if ( J[m] != 0 ) {
+	    count += J[m] + 1;
+	}
+    }
+
+    if ( size == _arena.size() && J == _J ) return false;
+
+    bool rc = false;
+    Arena arena;
+    arena.resize( size, count );
+    for ( size_t n = 0; n < size; ++n ) {
+	for ( unsigned m = 1; m <= M; ++m ) {
+	    const bool old = n < _arena.size() && m < _J.size() && _J[m] != 0;
+	    if ( old && _J[m] != J[m] ) {
+		rc = true;			/* Size change */
+	    }
+	    if ( J[m] == 0 ) continue;
+
+	    double * p = arena[n] + offset[m];
+	    if ( old && _J[m] == J[m] ) {
+		std::copy( _arena[n] + _offset[m], _arena[n] + _offset[m] + J[m] + 1, p );
+	    } else {
+		p[0] = 1.0;	// Initially, no servers busy with zero customers.
+		rc = true;
+	    }
+	}
+    }
+
+    _arena = arena;
+    _offset = offset;
+    _J = J;
+    return rc;
+}
+
+
+void
+N_m_j::clear()
+{
+    _arena.clear();
+    _offset.clear();
+    _J.clear();
+}
+
+
+
+/*
+ * Set the marginals of record n back to no servers busy.
+ */
+
+void
+N_m_j::reset( const size_t n )
+{
+    _arena.fill( n, 0.0 );
+    for ( unsigned m = 1; m < _J.size(); ++m ) {
+	if ( _J[m] != 0 ) {
+	    _arena[n][_offset[m]] = 1.0;
+	}
+    }
+}
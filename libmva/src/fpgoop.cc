@@ -301,19 +301,19 @@ fp_status_bits()
 }
 
 /*
- * return factorial.  Cache results.
+ * return factorial.  Results up to 100 are tabulated on the first call
+ * (the solvers may call this from several threads).
  */
 
 double
 factorial( unsigned n )
 {
-    static double a[101];
-    if ( n == 1 || n == 0 ) return 1.0;
+    static const struct Table {
+	Table() { a[0] = 1.0; for ( unsigned i = 1; i <= 100; ++i ) a[i] = static_cast<double>(i) * a[i-1]; }
+	double a[101];
+    } table;
     if ( n <= 100 ) {
-	if ( a[n] == 0 ) {
-	    a[n] = static_cast<double>(n) * factorial(n-1);
-	}
-	return a[n];
+	return table.a[n];
     } else {
 	double product;
 	for ( product = 1.0; n > 1; --n ) {
@@ -325,21 +325,21 @@ factorial( unsigned n )
 
 
 /*
- * return ln of factorial of n.  Cache results.
+ * return ln of factorial of n.  Tabulated as for factorial().
  */
 
 double
 log_factorial( const unsigned n )
 {
-    static double a[101];	/* Automatically initialized to zero! */
+    static const struct Table {
+	Table() { for ( unsigned i = 0; i <= 100; ++i ) a[i] = std::lgamma( i + 1.0 ); }
+	double a[101];
+    } table;
 	
     if ( n == 0 ) throw std::domain_error( "log_factorial(0)" );
     if ( n == 1 ) return 0.0;
     if ( n <= 100 ) {
-	if ( a[n] == 0 ) {
-	    a[n] = std::lgamma( n + 1.0 );
-	}
-	return a[n];
+	return table.a[n];
     } else {
 	return std::lgamma( n + 1.0 );
     }
@@ -353,6 +353,7 @@ log_factorial( const unsigned n )
 double
 binomial_coef( const unsigned n, const unsigned k )
 {
+    if ( k == 0 || k == n ) return 1.0;		/* log_factorial(0) throws */
     return floor( 0.5 + exp( log_factorial( n ) - log_factorial( k ) - log_factorial( n - k ) ) );
 }
 
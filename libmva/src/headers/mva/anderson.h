@@ -0,0 +1,54 @@
+/* -*- c++ -*-
+ * Anderson mixing for the fixed point iteration of the approximate
+ * MVA solvers.
+ *
+ * Copyright the Real-Time and Distributed Systems Group,
+ * Department of Systems and Computer Engineering,
+ * Carleton University, Ottawa, Ontario, Canada. K1S 5B6
+ *
+ * October 2026
+ *
+ * $Id$
+ *
+ * ------------------------------------------------------------------------
+ */
+
+#pragma once
+#if	!defined(LIBMVA_ANDERSON_H)
+#define	LIBMVA_ANDERSON_H
+
+#include <deque>
+#include <vector>
+
+/*
+ * Given the iterate x and g = G(x), mix() replaces g with a
+ * combination of the last depth+1 values of G that minimizes the
+ * combined residual G(x)-x in the least squares sense.  If the
+ * combination is not usable (negative, not finite, a singular system,
+ * or a residual that grows), the history is dropped and g is left as
+ * is, i.e., plain successive substitution.
+ */
+
+class Anderson
+{
+public:
+    static constexpr unsigned default_depth = 4;
+
+    explicit Anderson( const unsigned depth = 0 ) : _depth(depth), _dF(), _dG(), _f(), _g(), _norm(0.0) {}
+
+    unsigned depth() const { return _depth; }
+    void reset( const unsigned );
+    bool mix( const std::vector<double>& x, std::vector<double>& g );
+
+private:
+    bool restart();
+
+private:
+    unsigned _depth;			/* Differences kept.		*/
+    std::deque<std::vector<double> > _dF;	/* f(i+1) - f(i)	*/
+    std::deque<std::vector<double> > _dG;	/* G(i+1) - G(i)	*/
+    std::vector<double> _f;		/* Last residual.		*/
+    std::vector<double> _g;		/* Last G.			*/
+    double _norm;			/* |_f|				*/
+};
+#endif
@@ -0,0 +1,147 @@
+/* -*- c++ -*-
+ * Contiguous storage for the per-population arrays of the MVA solvers.
+ *
+ * Copyright the Real-Time and Distributed Systems Group,
+ * Department of Systems and Computer Engineering,
+ * Carleton University, Ottawa, Ontario, Canada. K1S 5B6
+ *
+ * October 2026
+ *
+ * $Id$
+ *
+ * ------------------------------------------------------------------------
+ */
+
+#pragma once
+#if	!defined(LIBMVA_ARENA_H)
+#define	LIBMVA_ARENA_H
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <vector>
+#include "vector.h"
+
+class Server;
+
+/*
+ * One 64 byte aligned block holding a record of doubles for each
+ * population offset n.  Records are padded to a multiple of 64 bytes
+ * so every record starts on a cache line.  Copies share the block (see
+ * Linearizer::alias()); the last one to go frees it.
+ */
+
+class Arena
+{
+public:
+    static constexpr size_t alignment = 64;
+
+    Arena() : _size(0), _stride(0), _block() {}
+
+    size_t size() const { return _size; }
+    double * operator[]( const size_t n ) const { return _block.get() + n * _stride; }
+
+    void resize( const size_t, const size_t );
+    void clear();
+    void fill( const double );
+    void fill( const size_t n, const double value ) { std::fill( (*this)[n], (*this)[n] + _stride, value ); }
+
+private:
+    size_t _size;			/* Number of records.		*/
+    size_t _stride;			/* Doubles per record.		*/
+    std::shared_ptr<double> _block;
+};
+
+
+
+/*
+ * [n][m][e][k] -- Queue length and utilization.  Station m is stored
+ * in a record as a (K+1) x E block by class then entry, so the sums
+ * over k and e in the sumOf functions walk memory with unit stride.
+ * The subscripts are resolved with index arithmetic by the small view
+ * classes below.
+ */
+
+class N_m_e_k
+{
+public:
+    class K_ref {
+    public:
+	K_ref( double * p, const unsigned E ) : _p(p), _E(E) {}
+	double& operator[]( const unsigned k ) const { return _p[k * _E]; }
+    private:
+	double * const _p;
+	const unsigned _E;
+    };
+
+    class E_k {
+    public:
+	E_k( double * p, const unsigned E ) : _p(p), _E(E) {}
+	K_ref operator[]( const unsigned e ) const { return K_ref( _p + (e - 1), _E ); }
+	double * row( const unsigned k ) const { return _p + k * _E; }	/* [e=1][k], classes k.. follow */
+    private:
+	double * const _p;
+	const unsigned _E;
+    };
+
+    class M_e_k {
+    public:
+	M_e_k( double * p, const size_t * offset, const unsigned * E ) : _p(p), _offset(offset), _E(E) {}
+	E_k operator[]( const unsigned m ) const { return E_k( _p + _offset[m], _E[m] ); }
+    private:
+	double * const _p;
+	const size_t * const _offset;
+	const unsigned * const _E;
+    };
+
+    N_m_e_k() : _arena(), _offset(), _E() {}
+
+    size_t size() const { return _arena.size(); }
+    M_e_k operator[]( const size_t n ) const { return M_e_k( _arena[n], _offset.data(), _E.data() ); }
+
+    void dimension( const size_t, const Vector<Server *>&, const unsigned );
+    void clear();
+    void fill( const double value ) { _arena.fill( value ); }
+    void fill( const size_t n, const double value ) { _arena.fill( n, value ); }
+
+private:
+    Arena _arena;
+    std::vector<size_t> _offset;	/* Start of station m.		*/
+    std::vector<unsigned> _E;		/* Entries at station m.	*/
+};
+
+
+
+/*
+ * [n][m][j] -- Marginal probabilities.  Only stations with a non-zero
+ * marginal size have space; P[n][m] is null otherwise.
+ */
+
+class N_m_j
+{
+public:
+    class M_j {
+    public:
+	M_j( double * p, const size_t * offset, const unsigned * J ) : _p(p), _offset(offset), _J(J) {}
+	double * operator[]( const unsigned m ) const { return _J[m] != 0 ? _p + _offset[m] : nullptr; }
+    private:
+	double * const _p;
+	const size_t * const _offset;
+	const unsigned * const _J;
+    };
+
+    N_m_j() : _arena(), _offset(), _J() {}
+
+    size_t size() const { return _arena.size(); }
+    M_j operator[]( const size_t n ) const { return M_j( _arena[n], _offset.data(), _J.data() ); }
+
+    bool dimension( const size_t, const Vector<Server *>& );
+    void clear();
+    void reset( const size_t );
+
+private:
+    Arena _arena;
+    std::vector<size_t> _offset;	/* Start of station m.		*/
+    std::vector<unsigned> _J;		/* Marginal size of station m.	*/
+};
+#endif
@@ -18,6 +18,9 @@
 #if	!defined(MULTI_SERVER_H)
 #define	MULTI_SERVER_H
 
+#include <map>
+#include <mutex>
+#include <vector>
 #include "server.h"
 #include "ph2serv.h"
 
@@ -191,44 +194,86 @@ private:
     class A_Iterator : public B_Iterator
     {
     public:
-	A_Iterator( const Server& aServer, const unsigned i, const Population& N, const unsigned k ): B_Iterator(aServer,N,k), class_i(i) {}
+	A_Iterator( const Server& aServer, const Population& N, const unsigned k ): B_Iterator(aServer,N,k), class_i(0) {}
 
 	virtual int operator()( Population& n );
+	A_Iterator& restart( const unsigned i ) { class_i = i; index = 0; return *this; }
 
     private:
-	const unsigned class_i;			/* index of class with at least 1 cust.	*/
+	unsigned class_i;			/* index of class with at least 1 cust.	*/
+    };
+
+    /*
+     * The populations generated by B_Iterator for one limit, with the
+     * parts of A() and meanMinimumService() that only depend on the
+     * population and the service times.  Terms are in iterator order.
+     */
+
+    struct Term {
+	Term( const unsigned f, const double s, const double p ) : first(f), service(s), prodOf_n(p) {}
+	unsigned first;				/* Index into Table::n		*/
+	double service;				/* meanMinimumService(n)	*/
+	double prodOf_n;			/* Product of n_i!, or of log	*/
+    };
+
+    struct Table {
+	Table() : n(), terms(), overflow(false) {}
+	size_t bytes() const { return n.capacity() * sizeof(n[0]) + terms.capacity() * sizeof(terms[0]); }
+	bool has( const unsigned t, const unsigned i ) const;
+
+	std::vector<std::pair<unsigned,unsigned> > n;	/* (i,n_i) of each term, n_i > 0 */
+	std::vector<Term> terms;		/* Last is a sentinel.		*/
+	bool overflow;				/* Over __max_populations.	*/
+    };
+
+    /*
+     * The tables a lane has already looked up.  Only the thread
+     * running the lane touches it, so hits do not need _lock.
+     */
+
+    struct Index {
+	Index() : revision(0), tables(), hits(0), fallbacks(0) {}
+	unsigned long revision;			/* Server::revision() of tables	*/
+	std::map<std::vector<unsigned>,const Table *> tables;
+	unsigned long hits;
+	unsigned long fallbacks;
     };
 
 public:
     Conway_Multi_Server( const unsigned copies )
 	: Server(),
-	  Reiser_Multi_Server(copies) {}
+	  Reiser_Multi_Server(copies), _tables(), _revision(0), _misses(0), _fallbacks(0), _index(1) {}
     Conway_Multi_Server( const unsigned copies, const unsigned k )
 	: Server(k),
-	  Reiser_Multi_Server(copies,k) {}
+	  Reiser_Multi_Server(copies,k), _tables(), _revision(0), _misses(0), _fallbacks(0), _index(1) {}
     Conway_Multi_Server( const unsigned copies, const unsigned e, const unsigned k )
 	: Server(e,k),
-	  Reiser_Multi_Server(copies,e,k) {}
+	  Reiser_Multi_Server(copies,e,k), _tables(), _revision(0), _misses(0), _fallbacks(0), _index(1) {}
     Conway_Multi_Server( const unsigned copies, const unsigned e, const unsigned k, const unsigned p )
 	: Server(e,k,p),
-	  Reiser_Multi_Server(copies,e,k,p) {}
+	  Reiser_Multi_Server(copies,e,k,p), _tables(), _revision(0), _misses(0), _fallbacks(0), _index(1) {}
 	
     virtual void wait( const MVA& solver, const unsigned k, const Population & N ) const;
     virtual void mixedWait( const MVA& solver, const Population& N ) const { return Reiser_Multi_Server::mixedWait( solver, N ); }
     virtual void openWait() const { return Reiser_Multi_Server::openWait(); }
+    virtual void setLanes( const unsigned );
 
     virtual const std::string& typeStr() const { return __type_str; }
+    virtual std::ostream& printStatistics( std::ostream& output, const unsigned = 0 ) const;
 
     static const std::string __type_str;
+    static unsigned long __max_populations;	/* Use Rolia above this, 0 for no limit. */
 
 protected:
-    double effectiveBacklog( const MVA& solver, const Population& N, const unsigned k ) const;
-    double departureTime( const MVA& solver, const Population& N, const unsigned k ) const;
+    Positive backlog( const MVA& solver, const Population& N, const unsigned k ) const;
 
 private:
-    double sumOf_PS_k( const MVA& solver, const Population& N, const unsigned k, Population::Iterator& next ) const;
+    const Table& table( const Population& N, const unsigned k ) const;
+    double effectiveBacklog( const MVA& solver, const Population& N, const unsigned k, const Table&, const std::vector<double>& u ) const;
+    double departureTime( const Table& table, const std::vector<double>& u ) const { return sumOf_PS_k( table, 0, u ); }
+    double sumOf_PS_k( const Table&, const unsigned i, const std::vector<double>& u ) const;
     double meanMinimumService( const Population& N ) const;
-    double A( const MVA& solver, const Population& n, const Population& N, const unsigned k ) const;
+    double A( const Table&, const unsigned t, const std::vector<double>& u ) const;
 
 #if DEBUG_MVA
     std::ostream& printXE( std::ostream&, const unsigned int i, const Population& N, const unsigned int k, const double xe, const double q ) const;
@@ -238,6 +283,13 @@ public:
     static bool debug_XE;
 #endif
 
+private:
+    mutable std::mutex _lock;			/* Guards building _tables.	*/
+    mutable std::map<std::vector<unsigned>,Table> _tables;	/* By limit, at most J	*/
+    mutable unsigned long _revision;		/* Server::revision() of _tables */
+    mutable unsigned long _misses;
+    mutable unsigned long _fallbacks;
+    mutable std::vector<Index> _index;		/* One per lane, no lock.	*/
 };
 
 /* ------------------- Phased Conway Multi Server   ------------------- */
@@ -332,6 +384,7 @@ public:
     virtual void openWait() const { return Reiser_Multi_Server::openWait(); }
 
     virtual unsigned int getMarginalProbabilitiesSize() const { return 0; }	/* No need for marginals	*/
+    virtual bool hasHistory() const { return true; }		/* filter() uses the last W	*/
 
     virtual const std::string& typeStr() const { return __type_str; }
 
@@ -520,6 +573,7 @@ public:
     virtual void openWait() const { return Reiser_Multi_Server::openWait(); }
 
     virtual unsigned int getMarginalProbabilitiesSize() const { return 0; }	/* No need for marginals	*/
+    virtual bool hasHistory() const { return true; }		/* P_mean() uses the last W	*/
 
     virtual const std::string& typeStr() const { return __type_str; }
 
@@ -20,13 +20,17 @@
 /* undef DEBUG_MVA 1 */
 #define BUG_471		1
 
+#include <memory>
 #include <vector>
+#include "anderson.h"
+#include "arena.h"
 #include "pop.h"
 #include "prob.h"
 #include "vector.h"
 
 class MVA;
 class Server;
+class ThreadPool;
 
 std::ostream& operator<<( std::ostream &, MVA& );
 
@@ -52,16 +56,6 @@ protected:
 	explicit iteration_limit( const std::string& aStr) : runtime_error( aStr ) {}
     };
 
-    /*
-     * This template provides access to a particular data type
-     * (templated) that is indexed initially by population.  The
-     * actual indicies for the population are decided by an input
-     * function that works on population vectors.
-     */
-
-//Shorthand for [N][m][e][k]
-    typedef std::vector<double ***> N_m_e_k;
-
 public:
     /* Function to create a MVA solver (because one can't take the address of constructors). */
     typedef MVA * (*new_solver)( Vector<Server *>&, const Population&, const Vector<double>&, const Vector<unsigned>&, const Vector<double>* );
@@ -141,12 +135,13 @@ public:
 
 protected:
     void dimension( const size_t );
-    bool dimension( std::vector<double **>&, const size_t );
-    void setMaxP();
     virtual const PopulationMap& getMap() const = 0;
     unsigned offset( const Population& N ) const { return getMap().offset( N ); }
     unsigned offset_e_j( const Population& N, const unsigned j ) const { return getMap().offset_e_j( N, j ); }
     void clearCount() { waitCount = 0; stepCount = 0; faultCount = 0; }
+    void addCount( const MVA& );
+    const Vector<double>& thinkTime() const { return Z; }
+    bool hasIndependentSteps() const;
 
 public:
     double throughput( const unsigned m, const unsigned k, const Population& N ) const;
@@ -170,6 +165,8 @@ protected:
     std::ostream& printStateP( std::ostream& output, const unsigned m, const Population& N ) const;
 
 private:
+    bool unitScaling( const Server& ) const;
+    const double * scaling( const Server&, const Population& N, const unsigned j, const bool ) const;
     double tau_overlap( const Server&, const unsigned j, const unsigned k, const Population& N ) const;
     double tau( const Server&, const unsigned j, const unsigned k, const Population& ) const;
 
@@ -181,7 +178,13 @@ public:
     std::ostream& printX( std::ostream& ) const;
 
 public:
+    static std::shared_ptr<ThreadPool> threadPool();	/* Shared by all solvers.	*/
+    static std::shared_ptr<ThreadPool> threadPool( const unsigned );	/* Fixed size, 0 for all cores	*/
+    static void forgetThreadPool();	/* Call in the child of fork()	*/
+
     static int __bounds_limit;		/* Enable bounds limiting.	*/
+    static unsigned __threads;		/* Threads for parallel solvers	*/
+    static unsigned __anderson;		/* Anderson depth, 0 for none.	*/
     static double MOL_multiserver_underrelaxation;
 #if DEBUG_MVA
     static bool debug_D;
@@ -208,11 +211,10 @@ protected:
     N_m_e_k L;				/* Queue length.		*/
     N_m_e_k U;				/* Station utilization.		*/
 
-    std::vector<double **> P;		/* For marginal probabilities.	*/
-    std::vector<double *> X;		/* Throughput per class.	*/
+    N_m_j P;				/* For marginal probabilities.	*/
+    Arena X;				/* Throughput per class.	*/
 
     unsigned long faultCount;		/* Number of times sc. fails	*/
-    Vector<size_t> maxP;		/* Dimension of P[][][J]	*/
 
 private:
     unsigned nPrio;			/* Number of unique priorities	*/
@@ -235,18 +237,31 @@ public:
     virtual Probability priorityInflation( const Server& station, const Population &N, const unsigned k ) const;
     virtual double filter() const { return 1.0; }
     virtual bool isExactMVA() const {return true;}
+    virtual ~ExactMVA();
+
 private:
-    unsigned offset( const Population& N ) const { return map.offset( N ); }
-    unsigned offset_e_j( const Population& N, const unsigned j ) const { return map.offset_e_j( N, j ); }
+    explicit ExactMVA( const ExactMVA * );
+
+    unsigned offset( const Population& N ) const { return _byLevel ? levels.offset( N ) : map.offset( N ); }
+    unsigned offset_e_j( const Population& N, const unsigned j ) const { return _byLevel ? levels.offset_e_j( N, j ) : map.offset_e_j( N, j ); }
+
+    bool isParallel() const;
+    bool canSolveByLevel() const;
+    void solveLevels();
+    void clearRow( const unsigned );
 
 private:
     virtual void marginalQueueProbabilities( const unsigned m, const Population& N );
     virtual void marginalStateProbabilities( const unsigned m, const Population& N );
 
-    virtual const PopulationMap& getMap() const { return map; }
+    virtual const PopulationMap& getMap() const { if ( _byLevel ) return levels; else return map; }
 
 private:
     FullPopulationMap map;
+    LevelPopulationMap levels;
+    bool _byLevel;			/* Using levels, not map.	*/
+    const ExactMVA * const _master;	/* Non-null for a lane.		*/
+    std::vector<ExactMVA *> _lanes;	/* One per thread for a level.	*/
     static const char * const __typeName;
 };
 
@@ -274,6 +289,7 @@ protected:
 private:
     void copy_L( const unsigned n ) const;
     double max_delta_L( const unsigned n, const Population &N ) const;
+    bool accelerate( const unsigned n, const Population &N );
 
     virtual void marginalQueueProbabilities( const unsigned m, const Population& N );
     virtual void marginalStateProbabilities( const unsigned m, const Population& N );
@@ -284,6 +300,8 @@ protected:
     const double termination_test;
     bool initialized;			/* True if initialized.		*/
     double ***last_L;			/* For local comparison.	*/
+private:
+    Anderson _anderson;			/* For core() if __anderson.	*/
 };
 
 
@@ -335,6 +353,8 @@ public:
     virtual const char * getTypeName() const { return __typeName; }
 
 protected:
+    explicit Linearizer( const Linearizer * );
+
     virtual const PopulationMap& getMap() const { return map; }
     virtual unsigned offset_e_c_e_j( const unsigned c, const unsigned j ) const { return getMap().offset_e_c_e_j( c, j ); }
 
@@ -348,14 +368,21 @@ protected:
     void save_L();
     void restore_L();
 
+    bool isParallel() const;
+    void solveLanes();
+    virtual Linearizer * newLane() const { return new Linearizer( this ); }
+    virtual void alias( const Linearizer& );
+
 protected:
     N_m_e_k saved_L;			/* Saved queue length.		*/
     N_m_e_k saved_U;			/* Saved utilization.		*/
-    std::vector<double **> saved_P;	/* Saved marginal queue.	*/
+    N_m_j saved_P;			/* Saved marginal queue.	*/
     double ****D;			/* Delta Fraction of jobs.	*/
     unsigned c;				/* Customer from class c removed*/
     PartialPopulationMap map;
+    const Linearizer * const _master;	/* Non-null for a lane.		*/
 private:
+    std::vector<Linearizer *> _lanes;	/* One per thread for N-e_c.	*/
     static const char * const __typeName;
 };
 
@@ -388,11 +415,15 @@ public:
     virtual double sumOf_SL_m( const Server&, const Population &, const unsigned ) const;
 
 protected:
+    explicit Linearizer2( const Linearizer2 * );
+
     void update_Delta( const Population & );
     void estimate_L( const Population & );
+    virtual Linearizer * newLane() const { return new Linearizer2( this ); }
+    virtual void alias( const Linearizer& );
 
 private:
-    std::vector<double *> Lm;		/* Queue length sum (Fast lin.)	*/
+    Arena Lm;				/* Queue length sum (Fast lin.)	*/
     double ***D_k;			/* Sum over k.			*/
     static const char * const __typeName;
 };
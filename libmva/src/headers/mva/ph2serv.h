@@ -57,6 +57,7 @@ public:
     virtual void wait( const MVA& solver, const unsigned k, const Population & N ) const;
 
     virtual void initStep( const MVA& );
+    virtual bool hasHistory() const { return true; }		/* Gamma uses the last R */
     virtual double prOt( const unsigned e, const unsigned k, const unsigned ) const { return Gamma[e][k]; }
 
     virtual std::ostream& printOutput( std::ostream& output, const unsigned = 0 ) const;
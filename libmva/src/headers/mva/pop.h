@@ -18,10 +18,14 @@
 #define	POPULATION_H
 
 #include <numeric>
+#include <vector>
 #include "vector.h"
 
 class Population 
 {
+public:
+    typedef Vector<unsigned,8> vector_type;	/* Up to 8 classes inline.	*/
+
 private:
     class Sum {
     public:
@@ -46,7 +50,7 @@ public:
 	int step( Population& N, const unsigned k );
 
     protected:
-	Vector<unsigned> limit;
+	vector_type limit;
 //	Population limit;
     };
 
@@ -61,14 +65,16 @@ public:
 	
     private:
 	const unsigned nClasses;
-	Vector<unsigned> stride;
+	vector_type stride;
 	unsigned arraysize;
     };
 
 public:
     Population( unsigned int size=0 );
     Population( const Population& N ) : _N(N._N) {}
+    Population( Population&& N ) noexcept : _N(std::move(N._N)) {}
     Population& operator=( const Population& N ) { _N = N._N; return *this; }
+    Population& operator=( Population&& N ) noexcept { _N = std::move(N._N); return *this; }
     unsigned operator[]( size_t i ) const { return _N[i]; }
     unsigned& operator[]( size_t i ) { return _N[i]; }
     bool operator==( const Population& N ) const { return _N == N._N; }
@@ -82,7 +88,7 @@ public:
     inline unsigned sum() const { return std::accumulate( _N.begin(), _N.end(), 0.0 ); }
 
 private:
-    Vector<unsigned> _N;
+    vector_type _N;
 
     
 };
@@ -173,13 +179,45 @@ public:
     unsigned offset_e_j( const Population & N, const unsigned j ) const;
 };
 
+//Support all populations, but only store two levels (a level is
+//every population with the same number of customers).  Level l
+//shares storage with level l-2, so the populations must be solved
+//level by level; population(l,i) enumerates them.  Memory is bounded
+//by the largest level rather than the whole lattice.
+class LevelPopulationMap : public PopulationMap
+{
+public:
+    LevelPopulationMap( const Population & N );
+    virtual ~LevelPopulationMap();
+
+    const PopulationMap& dimension( const Population & );
+
+    unsigned offset( const Population & N ) const { return position( N, 0 ); }
+    unsigned offset_e_j( const Population & N, const unsigned j ) const;
+
+    unsigned levels() const { return _levels; }
+    size_t size( const unsigned l ) const { return count( 1, l ); }
+    Population population( const unsigned l, size_t i ) const;
+
+private:
+    unsigned position( const Population & N, const unsigned j ) const;
+    size_t count( const unsigned i, const unsigned s ) const { return _count[i][s] - (s > 0 ? _count[i][s-1] : 0); }
+
+private:
+    unsigned _levels;			/* Customers in _maxN.		*/
+    size_t _width;			/* Size of the largest level.	*/
+    std::vector<std::vector<size_t> > _count;	/* [i][s] Populations of classes i..K with at most s customers */
+};
+
 //Only support the maximum customer configuration and the
 //case of one less of each customer in the population.
-//This is a triangular array since c <= j.
+//This is a triangular array since c <= j.  If split, N-e_c-e_j
+//and N-e_j-e_c are kept apart (c,j > 0) so that the reduced
+//populations N-e_c of the Linearizer can be solved at the same time.
 class PartialPopulationMap : public PopulationMap
 {
 public:
-    PartialPopulationMap( const Population & );
+    PartialPopulationMap( const Population &, const bool split = false );
     virtual ~PartialPopulationMap();
 
     const PopulationMap& dimension( const Population & );
@@ -193,6 +231,10 @@ public:
      * then NO customer is removed from the corresponding class.
      */
     unsigned offset_e_c_e_j( const unsigned c, const unsigned j ) const;
+    bool isSplit() const { return _split; }
+
+private:
+    const bool _split;
 };
 
 //Only support the maximum customer configuration.
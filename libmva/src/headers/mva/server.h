@@ -18,6 +18,7 @@
 #if	!defined(LIBMVA_SERVER_H)
 #define	LIBMVA_SERVER_H
 
+#include <vector>
 #include "pop.h"
 #include "prob.h"
 #include "vector.h"
@@ -42,6 +43,35 @@ std::ostream& operator<<( std::ostream&, const Server& );
 class Server
 {
 public:
+    /*
+     * Waiting times, W[e][k][p].  A parallel solver running several
+     * populations at once gives each of its workers a lane of its own
+     * (see Lane).  Lane 0 holds the results seen by everyone else.
+     */
+
+    class Wait {
+	friend class Server;
+    public:
+	double ** operator[]( const unsigned e ) const { return _lane[_lane.size() == 1 ? 0 : __lane][e]; }
+	unsigned lanes() const { return _lane.size(); }
+
+    private:
+	std::vector<double ***> _lane;
+    };
+
+    /*
+     * Select the lane of W used by this thread while in scope.
+     */
+
+    class Lane {
+    public:
+	explicit Lane( const unsigned i ) : _saved(__lane) { __lane = i; }
+	~Lane() { __lane = _saved; }
+
+    private:
+	const unsigned _saved;
+    };
+
     /* Initialization */
 
     Server() : openIndex(0), closedIndex(0), E(1), K(1), P(1) { initialize(); }
@@ -57,6 +87,7 @@ private:
 public:
     virtual void initStep( const MVA& );
     virtual void clear();
+    virtual void setLanes( const unsigned );
 
     /* Instance Variable Access */
 
@@ -93,6 +124,7 @@ public:
     double S( const unsigned k ) const;
     double S( const unsigned e, const unsigned k ) const { return s[e][k][0]; }
     double S( const unsigned e, const unsigned k, const unsigned p ) const { return s[e][k][p]; }
+    const double * S_e( const unsigned k ) const { return &_S_e[k * E]; }	/* S(1..E,k), then k+1...	*/
     double S_2() const;						/* Phase 2 service time	*/
     double S_2( const unsigned k ) const;
     double S_2( const unsigned e, const unsigned k ) const { return s[e][k][0] - s[e][k][1]; }
@@ -116,6 +148,7 @@ public:
     virtual unsigned int getMarginalProbabilitiesSize() const { return 0; }
     virtual void setMarginalProbabilitiesSize( const Population& ) { return; }
     virtual bool useStateProbabilities() const { return false; }
+    virtual bool hasHistory() const { return false; }		/* wait() uses results from the last step */
 
     virtual const std::string& typeStr() const = 0;
 
@@ -139,6 +172,7 @@ public:
     virtual std::ostream& print( std::ostream& output = std::cout ) const;
     virtual std::ostream& printHeading( std::ostream& output = std::cout ) const { return output; }
     virtual std::ostream& printOutput( std::ostream& output, const unsigned = 0 ) const { return output; }
+    virtual std::ostream& printStatistics( std::ostream& output, const unsigned = 0 ) const { return output; }
 
 protected:
     void setAndTotal( double *item, const unsigned phase, const double value );
@@ -146,14 +180,25 @@ protected:
 
     Probability rho() const;
     double priorityInflation( const MVA&, const Population &, const unsigned ) const;
+    unsigned long revision() const { return _revision; }	/* Changes with service or visits */
+    unsigned lane() const { return W.lanes() == 1 ? 0 : __lane; }	/* Lane of W for this thread */
 
     virtual std::ostream& printInput( std::ostream&, const unsigned, const unsigned ) const;
 
 private:
     void initialize();
+    void cacheS( const unsigned e, const unsigned k )
+	{
+	    double& s_ek = _S_e[k * E + (e - 1)];
+	    if ( s_ek == s[e][k][0] ) return;
+	    s_ek = s[e][k][0];
+	    _revision += 1;
+	}
+    double *** newWait() const;
+    void deleteWait( double *** ) const;
 
 public:
-    double ***W;		/* Waiting time per visit.	*/
+    Wait W;			/* Waiting time per visit.	*/
     unsigned openIndex;		/* Not used locally.		*/
     unsigned closedIndex;	/* Not used locally.		*/
 
@@ -166,6 +211,10 @@ private:
     double ***s;		/* Service Time per phase.	*/
     double ***v;		/* Visit ratios per phase.	*/
     Probability ** IL;		/* Interlocking probability.	*/
+    std::vector<double> _S_e;	/* S(e,k) stored by class then entry. */
+    unsigned long _revision;	/* Bumped when s or v change.	*/
+
+    static thread_local unsigned __lane;	/* Lane of W for this thread.	*/
 };
 
 
@@ -0,0 +1,64 @@
+/* -*- c++ -*-
+ * Vector kernels for the sumOf functions of the MVA solvers.
+ *
+ * Copyright the Real-Time and Distributed Systems Group,
+ * Department of Systems and Computer Engineering,
+ * Carleton University, Ottawa, Ontario, Canada. K1S 5B6
+ *
+ * October 2026
+ *
+ * $Id$
+ *
+ * ------------------------------------------------------------------------
+ */
+
+#pragma once
+#if	!defined(LIBMVA_SIMD_H)
+#define	LIBMVA_SIMD_H
+
+#include <cstddef>
+
+/*
+ * Reductions over a row of doubles.  By default every row is summed in
+ * order (SERIAL), which gives the results of the loops these replace.
+ * The other kernels are only used if chosen with setISA().  They sum
+ * runs shorter than threshold in order, and longer runs in lanes
+ * partial sums which are combined in a fixed order; every one of them,
+ * scalar or vector, uses the same lanes, so their results do not
+ * depend on the processor.
+ */
+
+class SIMD
+{
+public:
+    enum class ISA { SERIAL, SCALAR, SSE2, AVX2 };
+
+    struct Kernels {
+	double (*sum)( const double *, const size_t );
+	double (*dot)( const double *, const double *, const size_t );
+	double (*dot3)( const double *, const double *, const double *, const size_t );
+    };
+
+    static constexpr size_t threshold = 16;
+    static constexpr size_t lanes = 8;
+
+    /* sum x[i] */
+    static double sum( const double * x, const size_t n ) { return (n < threshold ? __serial : *__kernels).sum( x, n ); }
+    /* sum x[i] * y[i] */
+    static double dot( const double * x, const double * y, const size_t n ) { return (n < threshold ? __serial : *__kernels).dot( x, y, n ); }
+    /* sum x[i] * y[i] * z[i] */
+    static double dot3( const double * x, const double * y, const double * z, const size_t n ) { return (n < threshold ? __serial : *__kernels).dot3( x, y, z, n ); }
+
+    static bool supports( const ISA );
+    static const Kernels& kernels( const ISA );
+    static ISA isa() { return __isa; }
+    static void setISA( const ISA );
+    static const char * name( const ISA );
+    static ISA best();
+
+private:
+    static const Kernels __serial;	/* In order, and runs below threshold.	*/
+    static const Kernels * __kernels;	/* In use.		*/
+    static ISA __isa;
+};
+#endif
@@ -0,0 +1,81 @@
+/* -*- c++ -*-
+ * Thread pool for the parallel solvers.
+ *
+ * Copyright the Real-Time and Distributed Systems Group,
+ * Department of Systems and Computer Engineering,
+ * Carleton University, Ottawa, Ontario, Canada. K1S 5B6
+ *
+ * October 2026
+ *
+ * $Id$
+ *
+ * ------------------------------------------------------------------------
+ */
+
+#pragma once
+#if	!defined(LIBMVA_THREADPOOL_H)
+#define	LIBMVA_THREADPOOL_H
+
+#include <atomic>
+#include <cfenv>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/*
+ * A fixed set of worker threads running a parallel for-loop.  The
+ * thread calling run() takes part as worker 0, so a pool of size n
+ * starts n-1 threads.  Tasks are handed out dynamically.  Each task is
+ * passed its index and the number of the worker running it; the
+ * worker number is used by callers to select per-worker scratch
+ * storage.  Tasks run with the floating point environment of the
+ * caller and any exception flags they raise are returned to it.  The
+ * first exception thrown by a task is rethrown by run() once all
+ * tasks have finished.  A call to run() from inside a task runs the
+ * nested loop sequentially as worker 0.
+ */
+
+class ThreadPool
+{
+public:
+    typedef std::function<void(const size_t, const unsigned)> task_t;
+
+    explicit ThreadPool( const unsigned );
+    ~ThreadPool();
+
+private:
+    ThreadPool( const ThreadPool& ) = delete;
+    ThreadPool& operator=( const ThreadPool& ) = delete;
+
+public:
+    unsigned size() const { return _threads.size() + 1; }
+    void run( const size_t, const task_t& );
+
+    static unsigned hardware_concurrency();
+
+private:
+    void worker( const unsigned );
+    void execute( const unsigned );
+
+private:
+    std::vector<std::thread> _threads;
+    std::mutex _run;			/* One caller at a time.	*/
+    std::mutex _mutex;			/* Guards the fields below.	*/
+    std::condition_variable _start;
+    std::condition_variable _done;
+    const task_t * _task;
+    size_t _n;				/* Number of tasks.		*/
+    std::atomic<size_t> _next;		/* Next task to hand out.	*/
+    unsigned _busy;			/* Workers still running.	*/
+    unsigned long _generation;		/* Bumped for each run().	*/
+    bool _stop;
+    std::exception_ptr _error;		/* First exception thrown.	*/
+    int _fp_flags;			/* FP exceptions raised.	*/
+    std::fenv_t _fenv;			/* Caller's FP environment.	*/
+
+    static thread_local bool __inside;	/* True when running a task.	*/
+};
+#endif
@@ -1,7 +1,9 @@
 /* -*- c++ -*-
  * $Id: vector.h 17275 2024-09-10 20:35:49Z greg $
  *
- * Vector.  Range checked from 1..n (and not from 0..n-1).
+ * Vector.  Range checked from 1..n (and not from 0..n-1).  Vector<Type,n>
+ *         keeps up to n elements in the object itself, so short vectors
+ *         (i.e., Population) do not go to the heap.
  * VectorMath.  Adds the operators +, -, *, /, square, sum (so only use on numbers).
  *
  * Copyright the Real-Time and Distributed Systems Group,
@@ -19,19 +21,41 @@
 #define	LQNS_VECTOR_H
 
 #include <cassert>
+#include <cstddef>
 #include <iostream>
 #include <iterator>
+#include <utility>
 
-template <typename Type> class Vector;
+template <typename Type, size_t Local = 0> class Vector;
 template <typename Type> class VectorMath;
 template <typename Type> class VectorIterator;
-template <typename Type> inline std::ostream& operator << ( std::ostream& output, const Vector<Type>& self ) { return self.print( output ); }
+template <typename Type, size_t Local> inline std::ostream& operator << ( std::ostream& output, const Vector<Type,Local>& self ) { return self.print( output ); }
 template <typename Type> inline std::ostream& operator << ( std::ostream& output, const VectorMath<Type>& self ) { return self.print( output ); }
 
 const int VectorSize = 0;
 
+/*
+ * Inline storage for Vector<Type,Local>.  Empty when Local is zero.
+ */
+
+template <typename Type, size_t Local>
+class VectorBuffer {
+protected:
+    Type * local() { return _local; }
+    const Type * local() const { return _local; }
+private:
+    Type _local[Local];
+};
+
 template <typename Type>
-class Vector {
+class VectorBuffer<Type,0> {
+protected:
+    Type * local() { return nullptr; }
+    const Type * local() const { return nullptr; }
+};
+
+template <typename Type, size_t Local>
+class Vector : private VectorBuffer<Type,Local> {
 public:
     typedef Type * iterator;
     typedef const Type * const_iterator;
@@ -49,20 +73,18 @@ public:
 public: 
     explicit Vector( size_t size=0 ) : ia(nullptr), sz(0), mx(0) { resize( size ); }
     Vector( const Type *ar, size_t sz ) { init(ar,sz); }
-    Vector( const Vector<Type> &iA ) { init( iA.ia, iA.sz ); }
+    Vector( const Vector &iA ) { init( iA.ia, iA.sz ); }
+    Vector( Vector&& iA ) noexcept : ia(nullptr), sz(0), mx(0) { take( iA ); }
     virtual ~Vector() { clear(); }
     void clear()
 	{
-	    if ( ia ) {
-		ia += 1;		/* Fix offset before deletion.	*/
-		delete [] ia;
-	    }
+	    release( ia );
 	    ia = nullptr;
 	    sz = 0;
 	    mx = 0;
 	}
 
-    bool operator==( const Vector<Type>& arg ) const
+    bool operator==( const Vector& arg ) const
 	{
 	    const size_t n = size();
 	    for ( size_t i = 1; i <= n; ++i ) {
@@ -70,15 +92,29 @@ public:
 	    }
 	    return true;
 	}
-    Vector<Type>& operator=( const Vector<Type>& iA )
+    Vector& operator=( const Vector& iA )
 	{
 	    if ( this == &iA ) return *this;
+	    if ( iA.sz > 0 && iA.sz <= mx ) {	/* Reuse the storage.		*/
+		sz = iA.sz;
+		for ( size_t ix = 1; ix <= sz; ++ix ) {
+		    ia[ix] = iA.ia[ix];
+		}
+		return *this;
+	    }
 	    clear();
 	    init( iA.ia, iA.sz );
 	    return *this;
 	}	    
+    Vector& operator=( Vector&& iA ) noexcept
+	{
+	    if ( this == &iA ) return *this;
+	    clear();
+	    take( iA );
+	    return *this;
+	}
 
-    Vector<Type>& operator=( const Type& arg )
+    Vector& operator=( const Type& arg )
 	{
 	    const size_t n = size();
 	    for ( size_t i = 1; i <= n; ++i ) {
@@ -116,10 +152,7 @@ public:
 	    sz = newSize;
 	    if ( sz > mx ) {
 		mx = sz * 2;
-		ia = new Type[mx];
-		assert ( ia != nullptr );
-	
-		ia -= 1;				/* Offset to allow 1..n index	*/
+		ia = allocate( mx );
 
 		for ( ix = 1; ix < index; ++ix ) {	/* Copy unchanged part.		*/
 		    ia[ix] = oldia[ix];
@@ -133,20 +166,19 @@ public:
 	    assert ( 0 < index && index <= newSize );
 	    ia[index] = value;				/* Add new element.		*/
     
-	    if ( oldia != nullptr && oldia != ia ) {
-		oldia += 1;				/* Fix offset before deletion.	*/
-		delete [] oldia;
+	    if ( oldia != ia ) {
+		release( oldia );
 	    }
 	}
     void push_back( const Type& arg ) { insert( size()+1, arg ); }
     iterator erase( const_iterator pos )
 	{
-	    Vector<Type>::iterator dst = const_cast<Vector<Type>::iterator>(pos);
-	    for ( Vector<Type>::iterator src = dst + 1; src != end(); ++src, ++dst ) {
+	    iterator dst = const_cast<iterator>(pos);
+	    for ( iterator src = dst + 1; src != end(); ++src, ++dst ) {
 		*dst = *src;
 	    }
 	    shrink( 1 );
-	    return const_cast<Vector<Type>::iterator>(pos) + 1;
+	    return const_cast<iterator>(pos) + 1;
 	}
     
     std::ostream& print( std::ostream& output = std::cout ) const
@@ -179,9 +211,7 @@ protected:
 
 	    if ( sz > mx ) {
 		mx = sz * 2;
-		ia = new Type[mx];
-		assert ( ia != nullptr );
-		ia -= 1;			/* Offset to allow 1..n index	*/
+		ia = allocate( mx );
 
 		for ( size_t ix = 1; ix <= minSize; ++ix ) {
 		    ia[ix] = oldia[ix];		/* Copy to new array.		*/
@@ -189,11 +219,14 @@ protected:
 		for ( size_t ix = minSize + 1; ix <= mx; ++ix ) {
 		    ia[ix] = val;		/* Clear everything afterwards */
 		}
+	    } else {
+		for ( size_t ix = minSize + 1; ix <= sz; ++ix ) {
+		    ia[ix] = val;		/* Storage may have been reused	*/
+		}
 	    }
 
-	    if ( oldia != nullptr && oldia != ia ) {
-		oldia += 1;			/* Fix offset before deletion.	*/
-		delete [] oldia;
+	    if ( oldia != ia ) {
+		release( oldia );
 	    }
 	}
     void shrink( size_t amt )
@@ -206,23 +239,21 @@ protected:
 	    const size_t oldSize = sz;
 	    sz = oldSize - amt;
 
-	    if ( sz ) {
+	    if ( isLocal( oldia ) && sz ) {
+		return;				/* Nothing to give back.	*/
+	    } else if ( sz ) {
 		mx = sz;
-		ia = new Type[sz];
-		assert ( ia != nullptr );
-		ia -= 1;			/* Offset to allow 1..n index	*/
+		ia = allocate( mx );
 
 		for ( size_t ix = 1; ix <= sz; ++ix ) {
 		    ia[ix] = oldia[ix];
 		}
 	    } else {
 		ia = nullptr;
+		mx = 0;
 	    }
 
-	    if ( oldia != nullptr ) {
-		oldia += 1;		/* Fix offset before deletion.	*/
-		delete [] oldia;
-	    }
+	    release( oldia );
 	}
     
 private:
@@ -230,14 +261,65 @@ private:
 	{
 	    sz = size;
 	    mx = size;
-	    ia = new Type[mx];
-	    assert( ia != nullptr );
-	    ia -= 1;			/* Offset for 1..n addressing	*/
+	    ia = allocate( mx );
 	    for ( size_t ix = 1; ix <= sz; ++ix ) {
 		ia[ix] = vector[ix];
 	    }
 	}
 
+    /*
+     * Take the storage from iA, which is left empty.  Inline storage
+     * can't be taken, so the elements are moved instead.
+     */
+
+    void take( Vector& iA )
+	{
+	    if ( iA.ia == nullptr ) return;
+	    if ( iA.isLocal( iA.ia ) ) {
+		sz = iA.sz;
+		mx = Local;
+		ia = this->local() - 1;
+		for ( size_t ix = 1; ix <= sz; ++ix ) {
+		    ia[ix] = std::move( iA.ia[ix] );
+		}
+	    } else {
+		ia = iA.ia;
+		sz = iA.sz;
+		mx = iA.mx;
+	    }
+	    iA.ia = nullptr;
+	    iA.sz = 0;
+	    iA.mx = 0;
+	}
+
+    /*
+     * Storage for n elements, offset for 1..n addressing.  Use the
+     * inline buffer if it is large enough; n is set to the capacity.
+     */
+
+    Type * allocate( size_t& n )
+	{
+	    if ( n == 0 ) {
+		return nullptr;
+	    } else if ( n <= Local ) {
+		n = Local;
+		return this->local() - 1;
+	    } else {
+		Type * p = new Type[n];
+		assert( p != nullptr );
+		return p - 1;
+	    }
+	}
+
+    void release( Type * p )
+	{
+	    if ( p == nullptr || isLocal( p ) ) return;
+	    p += 1;			/* Fix offset before deletion.	*/
+	    delete [] p;
+	}
+
+    bool isLocal( const Type * p ) const { return Local > 0 && p == this->local() - 1; }
+
 protected:
     Type *ia;
 
@@ -255,7 +337,10 @@ public:
     explicit VectorMath( size_t size=0, const Type init=Type() ) : Vector<Type>() { this->grow( size, init ); }
     VectorMath( const Type *ar, size_t sz ) : Vector<Type>( ar, sz ) {}
     VectorMath( const VectorMath<Type> &iA ) : Vector<Type>( iA ) {}
+    VectorMath( VectorMath<Type>&& iA ) noexcept : Vector<Type>( std::move( iA ) ) {}
 
+    VectorMath<Type>& operator=( const VectorMath<Type>& arg ) { Vector<Type>::operator=( arg ); return *this; }
+    VectorMath<Type>& operator=( VectorMath<Type>&& arg ) noexcept { Vector<Type>::operator=( std::move( arg ) ); return *this; }
     VectorMath<Type>& operator=( const Vector<Type>& arg ) { Vector<Type>::operator=( arg ); return *this; }
     VectorMath<Type>& operator=( const Type& arg ) { Vector<Type>::operator=( arg ); return *this; }
     bool operator==( const Vector<Type>& arg ) const { return Vector<Type>::operator==( arg ); }
@@ -353,6 +353,7 @@ Reiser_PS_Multi_Server::sumOf_L( const MVA& solver, const Population& N, const u
 /*----------------------------------------------------------------------*/
 
 const std::string Conway_Multi_Server::__type_str = "Conway_Multi_Server";
+unsigned long Conway_Multi_Server::__max_populations = 0;
 
 /*
  * Waiting time expressions as per de Souza e Silva and Muntz, (19).
@@ -362,7 +363,7 @@ const std::string Conway_Multi_Server::__type_str = "Conway_Multi_Server";
 void
 Conway_Multi_Server::wait( const MVA& solver, const unsigned k, const Population& N ) const
 {
-    const Positive sum = effectiveBacklog( solver, N, k ) + solver.PB( *this, N, k ) * departureTime( solver, N, k );
+    const Positive sum = backlog( solver, N, k );
 
     for ( unsigned e = 1; e <= E; ++e ) {
 	if ( !V(e,k) ) continue;
@@ -372,64 +373,168 @@ Conway_Multi_Server::wait( const MVA& solver, const unsigned k, const Population
     }
 }
 
+
 /*
- * XE term: Eqn (18).
+ * XE + PB * XR, the common part of the Conway waiting times.  The
+ * populations come from table(); only the utilizations change from
+ * step to step.  If there are too many populations, use the Rolia
+ * expression instead.
  */
 
-double
-Conway_Multi_Server::effectiveBacklog( const MVA& solver, const Population& N, const unsigned k ) const
+Positive
+Conway_Multi_Server::backlog( const MVA& solver, const Population& N, const unsigned k ) const
 {
-    Positive sum = 0.0;
+    if ( N[k] == 0 || V(k) == 0.0 ) return 0.0;
 
-    if ( N[k] == 0 || V(k) == 0.0 ) return sum;
+    const Table& populations = table( N, k );
+    if ( populations.overflow ) {
+	const Probability PB = power( std::min( 1.0, solver.sumOf_U_m( *this, N, k ) / mu() ), static_cast<unsigned>(mu()) );
+	return PB * solver.sumOf_SL_m( *this, N, k ) / mu();
+    }
 
+    static thread_local std::vector<double> u;
+    u.resize( K + 1 );
     for ( unsigned i = 1; i <= K; ++i ) {
-	if ( N[i] == 0 ) continue;
+	u[i] = solver.utilization( *this, i, N, k );
+    }
 
-	A_Iterator nextA( *this, i, N, k );
-	const double xe = sumOf_PS_k( solver, N, k, nextA );
-	const double q = solver.queueOnly( *this, i, N, k );
-#if	DEBUG_MVA
-	if ( debug_XE ) printXE( std::cout, i, N, k, xe, q );
-#endif
-	sum += xe * q;
+    return effectiveBacklog( solver, N, k, populations, u ) + solver.PB( *this, N, k ) * departureTime( populations, u );
+}
+
+
+/*
+ * The populations for N less one customer in class k.  Classes which
+ * don't visit are empty, and no class can have more than J customers,
+ * so the limit is clipped to J.  This lets populations N which differ
+ * only in classes with more than J customers share a table.  The tables
+ * are dropped whenever the service times or visits change.
+ */
+
+const Conway_Multi_Server::Table&
+Conway_Multi_Server::table( const Population& N, const unsigned k ) const
+{
+    const unsigned J = static_cast<unsigned>(mu());
+    static thread_local std::vector<unsigned> limit;
+    limit.resize( K );
+    for ( unsigned i = 1; i <= K; ++i ) {
+	limit[i-1] = V(i) ? std::min( N[i] - (i == k ? 1 : 0), J ) : 0;
     }
-    return sum;
+
+    /* Tables are only dropped when the service times or visits change, */
+    /* which never happens while lanes are running, so a lane may keep  */
+    /* pointers into _tables until revision() moves on.                 */
+
+    Index& index = _index[lane()];
+    if ( index.revision != revision() ) {
+	index.tables.clear();
+	index.revision = revision();
+    }
+    std::map<std::vector<unsigned>,const Table *>::const_iterator found = index.tables.find( limit );
+    if ( found != index.tables.end() ) {
+	index.hits += 1;
+	if ( found->second->overflow ) index.fallbacks += 1;
+	return *found->second;
+    }
+
+    std::lock_guard<std::mutex> lock( _lock );
+    if ( _revision != revision() ) {
+	_tables.clear();
+	_revision = revision();
+    }
+    std::map<std::vector<unsigned>,Table>::iterator item = _tables.find( limit );
+    if ( item != _tables.end() ) {
+	index.tables[limit] = &item->second;
+	index.hits += 1;
+	if ( item->second.overflow ) index.fallbacks += 1;
+	return item->second;
+    }
+    _misses += 1;
+
+    Table& populations = _tables[limit];
+    index.tables[limit] = &populations;
+    B_Iterator next( *this, N, k );
+    Population n(K);
+    while ( next( n ) ) {
+	assert( n.sum() == mu() );
+	if ( __max_populations > 0 && populations.terms.size() >= __max_populations ) {
+	    populations.overflow = true;
+	    populations.n.clear();
+	    populations.terms.clear();
+	    _fallbacks += 1;
+	    return populations;
+	}
+	double prodOf_n = (mu() > 10.0) ? 0.0 : 1.0;
+	const unsigned first = populations.n.size();
+	for ( unsigned i = 1; i <= K; ++i ) {
+	    if ( n[i] == 0 ) continue;
+	    populations.n.push_back( std::pair<unsigned,unsigned>( i, n[i] ) );
+	    if ( mu() > 10.0 ) {
+		prodOf_n += log_factorial( n[i] );
+	    } else {
+		prodOf_n *= factorial( n[i] );
+	    }
+	}
+	populations.terms.push_back( Term( first, meanMinimumService( n ), prodOf_n ) );
+    }
+    populations.terms.push_back( Term( populations.n.size(), 0.0, 0.0 ) );
+    return populations;
 }
 
 
 /*
- * XR term: Eqn (16).
+ * True if term t has a customer in class i.
+ */
+
+bool
+Conway_Multi_Server::Table::has( const unsigned t, const unsigned i ) const
+{
+    for ( unsigned j = terms[t].first; j < terms[t+1].first; ++j ) {
+	if ( n[j].first == i ) return true;
+    }
+    return false;
+}
+
+
+/*
+ * XE term: Eqn (18).
  */
 
 double
-Conway_Multi_Server::departureTime( const MVA& solver, const Population& N, const unsigned k ) const
+Conway_Multi_Server::effectiveBacklog( const MVA& solver, const Population& N, const unsigned k, const Table& populations, const std::vector<double>& u ) const
 {
-    if ( N[k] == 0 || V(k) == 0.0 ) return 0.0;
+    Positive sum = 0.0;
 
-    B_Iterator nextB( *this, N, k );
+    for ( unsigned i = 1; i <= K; ++i ) {
+	if ( N[i] == 0 ) continue;
 
-    return  sumOf_PS_k( solver, N, k, nextB );
+	const double xe = sumOf_PS_k( populations, i, u );
+	const double q = solver.queueOnly( *this, i, N, k );
+#if	DEBUG_MVA
+	if ( debug_XE ) printXE( std::cout, i, N, k, xe, q );
+#endif
+	sum += xe * q;
+    }
+    return sum;
 }
 
 
-
 /*
- * Common expression to XE and XR calculation.  The `next' argument
- * determines the values that are used in the sum. Eqns (9) and (13).
+ * Common expression to XE and XR calculation.  XE uses the populations
+ * with at least one customer in class i, XR (i == 0) uses them all.
+ * Eqns (9) and (13).
  */
 
 double
-Conway_Multi_Server::sumOf_PS_k( const MVA& solver, const Population& N, const unsigned k, Population::Iterator& next ) const
+Conway_Multi_Server::sumOf_PS_k( const Table& populations, const unsigned i, const std::vector<double>& u ) const
 {
     Positive sumOf_C = 0.0;
     Positive sumOf_A = 0.0;
-    Population n(K);				// Need to sequence over this.
 
-    while ( next( n ) ) {
-	assert( n.sum() == mu() );
-	const double A_ = A( solver, n, N, k );
-	sumOf_A += A_ * meanMinimumService( n );
+    const unsigned T = populations.terms.size() - 1;
+    for ( unsigned t = 0; t < T; ++t ) {
+	if ( i != 0 && !populations.has( t, i ) ) continue;
+	const double A_ = A( populations, t, u );
+	sumOf_A += A_ * populations.terms[t].service;
 	sumOf_C += A_;
     }
 
@@ -438,38 +543,80 @@ Conway_Multi_Server::sumOf_PS_k( const MVA& solver, const Population& N, const u
 
 
 /*
- * `A' term: Eqn (10).
+ * `A' term: Eqn (10).  u[i] is the utilization of class i with one
+ * customer of class k removed.
  */
 
 double
-Conway_Multi_Server::A( const MVA& solver, const Population& n, const Population& N, const unsigned k ) const
+Conway_Multi_Server::A( const Table& populations, const unsigned t, const std::vector<double>& u ) const
 {
+    const unsigned first = populations.terms[t].first;
+    const unsigned last = populations.terms[t+1].first;
     if ( mu() > 10.0 ) {
 	double prodOf_F = 0.0;
-	double prodOf_n = 0.0;
-	for ( unsigned i = 1; i <= K; ++i ) {
-	    if ( n[i] == 0 ) continue;		// Fast short cut.
-	    double u = solver.utilization( *this, i, N, k );
-	    if ( u > 0.0 ) {
-		prodOf_F += log( u ) * n[i];
+	for ( unsigned j = first; j < last; ++j ) {
+	    const unsigned i = populations.n[j].first;
+	    if ( u[i] > 0.0 ) {
+		prodOf_F += log( u[i] ) * populations.n[j].second;
 	    }
-	    prodOf_n += log_factorial( n[i] );
 	}
-	return exp( log_factorial( static_cast<unsigned>(mu()) ) + prodOf_F - prodOf_n );
+	return exp( log_factorial( static_cast<unsigned>(mu()) ) + prodOf_F - populations.terms[t].prodOf_n );
     } else {
 	double prodOf_F = 1.0;
-	double prodOf_n = 1.0;
-	for ( unsigned i = 1; i <= K; ++i ) {
-	    if ( n[i] == 0 ) continue;		// Fast short cut.
-	    double u = solver.utilization( *this, i, N, k );
-	    if ( u > 0.0 ) {
-		prodOf_F *= power( u, n[i] );
+	for ( unsigned j = first; j < last; ++j ) {
+	    const unsigned i = populations.n[j].first;
+	    if ( u[i] > 0.0 ) {
+		prodOf_F *= power( u[i], populations.n[j].second );
 	    }
-	    prodOf_n *= factorial( n[i] );
 	}
-	return factorial( static_cast<unsigned>(mu()) ) * prodOf_F / prodOf_n;
+	return factorial( static_cast<unsigned>(mu()) ) * prodOf_F / populations.terms[t].prodOf_n;
+    }
+}
+
+
+
+/*
+ * Give each lane of W its own index of the tables.  Called before the
+ * lanes start running.
+ */
+
+void
+Conway_Multi_Server::setLanes( const unsigned n )
+{
+    Server::setLanes( n );
+    if ( _index.size() < n ) {
+	_index.resize( n );
     }
+}
+
 
+
+/*
+ * Size and use of the population tables since the station was created.
+ */
+
+std::ostream&
+Conway_Multi_Server::printStatistics( std::ostream& output, const unsigned m ) const
+{
+    std::lock_guard<std::mutex> lock( _lock );
+    if ( _misses == 0 ) return output;
+
+    unsigned long hits = 0;
+    unsigned long fallbacks = _fallbacks;
+    for ( std::vector<Index>::const_iterator lane = _index.begin(); lane != _index.end(); ++lane ) {
+	hits += lane->hits;
+	fallbacks += lane->fallbacks;
+    }
+
+    size_t terms = 0;
+    size_t bytes = 0;
+    for ( std::map<std::vector<unsigned>,Table>::const_iterator item = _tables.begin(); item != _tables.end(); ++item ) {
+	if ( !item->second.terms.empty() ) terms += item->second.terms.size() - 1;
+	bytes += item->first.capacity() * sizeof(unsigned) + item->second.bytes();
+    }
+    output << m << ": Conway tables = " << _tables.size() << ", populations = " << terms << ", bytes = " << bytes
+	   << ", hits = " << hits << ", misses = " << _misses << ", fallbacks = " << fallbacks << std::endl;
+    return output;
 }
 
 
@@ -524,7 +671,7 @@ const std::string Phased_Conway_Multi_Server::__type_str = "Phased_Conway_Multi_
 void
 Phased_Conway_Multi_Server::wait( const MVA& solver, const unsigned k, const Population& N ) const
 {
-    const Positive sum = effectiveBacklog( solver, N, k ) + solver.PB( *this, N, k ) * departureTime( solver, N, k );
+    const Positive sum = backlog( solver, N, k );
 
     for ( unsigned e = 1; e <= E; ++e ) {
 	if ( !V(e,k) ) continue;
@@ -547,7 +694,7 @@ const std::string Markov_Phased_Conway_Multi_Server::__type_str = "Markov_Phased
 void
 Markov_Phased_Conway_Multi_Server::wait( const MVA& solver, const unsigned k, const Population& N ) const
 {
-    const Positive sum = effectiveBacklog( solver, N, k ) + solver.PB( *this, N, k ) * departureTime( solver, N, k );
+    const Positive sum = backlog( solver, N, k );
 
     for ( unsigned e = 1; e <= E; ++e ) {
 	if ( !V(e,k) ) continue;
@@ -142,13 +142,20 @@
 #include <cstdlib>
 #include <cassert>
 #include <limits>
+#include <map>
+#include <memory>
+#include <mutex>
 #include "mva.h"
 #include "mvaexception.h"
 #include "fpgoop.h"
 #include "server.h"
+#include "simd.h"
 #include "prob.h"
+#include "threadpool.h"
 
 int MVA::__bounds_limit = 0;		/* Enable bounds limiting if non-zero */
+unsigned MVA::__threads = 1;		/* Sequential, 0 for all cores.	*/
+unsigned MVA::__anderson = 0;		/* Plain successive substitution */
 double MVA::MOL_multiserver_underrelaxation = 0.5;	/* For MOL Multiservers */
 #if DEBUG_MVA
 bool MVA::debug_D = false;
@@ -184,6 +191,8 @@ std::ostream& operator<<( std::ostream& output, MVA& model )
  *	NCust: Maximum number of customers in each class.
  *	L: Queue Length.  (Storage allocated by subclass)
  *	U: Station utilization (Storage allocated by subclass)
+ *	P: Marginal probabilities (Storage allocated by subclass)
+ *	X: Throughput (Storage allocated by subclass)
  */
 
 MVA::MVA( Vector<Server *>& q, const Population& N,
@@ -191,7 +200,7 @@ MVA::MVA( Vector<Server *>& q, const Population& N,
 	  const Vector<double>* of )
     : NCust(N), M(q.size()), K(N.size()), Q(q), Z(thinkTime),
       priority(prio), overlapFactor(of), L(), U(), P(), X(),
-      faultCount(0), maxP(q.size()),
+      faultCount(0),
       nPrio(0), sortedPrio(), stepCount(0), waitCount(0), _isThread()
 {
     assert( M > 0 && K > 0 );
@@ -201,149 +210,29 @@ MVA::MVA( Vector<Server *>& q, const Population& N,
 
 
 /*
- * Release storage.
+ * Storage is released by the arenas.
  */
 
 MVA::~MVA()
 {
-    dimension( 0 );
 }
 
 
 /*
- * Allocate queue length storage for all M stations and K classes.
+ * Allocate storage for all M stations and K classes at size
+ * populations.  Each array is a single block (see arena.h).
  */
 
 void
 MVA::dimension( const size_t size )
 {
-    const size_t old_size = L.size();
-    
-    if ( old_size < size ) {
-
-	/* If array got bigger, add more space */
-
-	L.resize(size);
-	U.resize(size);
-	P.resize(size);
-	X.resize(size);
-
-	for ( unsigned n = old_size; n < size; ++n) {
-	    L[n] = new double ** [M+1];
-	    U[n] = new double ** [M+1];
-	    P[n] = new double * [M+1];
-	    L[n][0] = nullptr;
-	    U[n][0] = nullptr;
-	    P[n][0] = nullptr;
-
-	    for ( unsigned m = 1; m <= M; ++m ) {
-		const unsigned E = Q[m]->nEntries();
-		L[n][m] = new double * [E+1];
-		U[n][m] = new double * [E+1];
-		P[n][m] = nullptr;
-		L[n][m][0] = nullptr;
-		U[n][m][0] = nullptr;
-
-		for ( unsigned e = 1; e <= E; ++e ) {
-		    L[n][m][e] = new double [K+1];
-		    U[n][m][e] = new double [K+1];
-
-		    for ( unsigned k = 0; k <= K; k++ ) {
-			L[n][m][e][k] = 0.0;
-			U[n][m][e][k] = 0.0;
-		    }
-		}
-	    }
-
-	    X[n] = new double [K+1];
-
-	    for ( unsigned k = 1; k <= K; ++k ) {
-		X[n][k] = 0.0;
-	    }
-	}
-
-    } else if ( size < old_size ) {
-
-	/* if the array got smaller, delete space from the end. */
-
-	for ( unsigned n = old_size; n > size; ) {
-	    n -= 1;
-	    for ( unsigned m = 1; m <= M; ++m ) {
-		const unsigned E = Q[m]->nEntries();
-
-		for ( unsigned e = 1; e <= E; ++e ) {
-		    delete [] L[n][m][e];
-		    delete [] U[n][m][e];
-		}
-
-		delete [] L[n][m];
-		delete [] U[n][m];
-		delete [] P[n][m];
-	    }
-
-	    delete [] L[n];
-	    delete [] U[n];
-	    delete [] P[n];
-	    delete [] X[n];
-
-	}
-
-	L.resize(size);
-	U.resize(size);
-	X.resize(size);
-	P.resize(size);
-    }
-
-    dimension( P, size );
-    setMaxP();
-}
-
-
-
-/*
- * Allocate space for stations needing marginal probabilities.  This
- * is a little more hairy than the other dimension case because the
- * size of the marginal probabilities can change too.
- */
-
-bool
-MVA::dimension( std::vector<double **>& array, const size_t size )
-{
-    bool rc = false;
-    for ( unsigned n = 0; n < size; ++n ) {
-	for ( unsigned m = 1; m <= M; ++m ) {
-	    const unsigned J = Q[m]->getMarginalProbabilitiesSize();
-	    if ( (J == 0 || J != maxP[m]) && array[n][m] ) {	// Size change
-		delete [] array[n][m];
-		array[n][m] = nullptr;
-		rc = true;
-	    }
-	    if ( J != 0 && array[n][m] == nullptr ) {
-		array[n][m] = new double [J+1];
-		for ( unsigned j = 0; j <= J; ++j ) {
-		    array[n][m][j] = 0.0;
-		}
-		array[n][m][0] = 1.0;	// Initially, no servers busy with zero customers.
-		rc = true;
-	    }
-	}
-    }
-    return rc;
+    L.dimension( size, Q, K );
+    U.dimension( size, Q, K );
+    X.resize( size, K+1 );
+    P.dimension( size, Q );
 }
 
 
-/*
- * Set the maximum dimension of the marginals.  It's NOT done in dimension because we may have to redimension two arrays (P and saved_P); the old value is needed.
- */
-
-void
-MVA::setMaxP()
-{
-    for ( unsigned m = 1; m <= M; ++m ) {
-	maxP[m] = Q[m]->getMarginalProbabilitiesSize();
-    }
-}
-
 
 /*
  * Reset everything back to zero.
@@ -353,24 +242,13 @@ void
 MVA::reset()
 {
     const size_t size = L.size();
-    dimension( P, size );
+    P.dimension( size, Q );
+    L.fill( 0.0 );
+    U.fill( 0.0 );
+    X.fill( 0.0 );
 
     for ( unsigned n = 0; n < size; ++n) {
-	assert( L[n][0] == nullptr );
-	assert( U[n][0] == nullptr );
-
 	for ( unsigned m = 1; m <= M; ++m ) {
-	    const unsigned E = Q[m]->nEntries();
-	    assert( L[n][m][0] == nullptr );
-	    assert( U[n][m][0] == nullptr );
-
-	    for ( unsigned e = 1; e <= E; ++e ) {
-		for ( unsigned k = 0; k <= K; k++ ) {
-		    L[n][m][e][k] = 0.0;
-		    U[n][m][e][k] = 0.0;
-		}
-	    }
-
 	    if ( P[n][m] ) {
 		const unsigned J = Q[m]->getMarginalProbabilitiesSize();
 		for ( unsigned j = 0; j <= J; ++j ) {
@@ -379,13 +257,7 @@ MVA::reset()
 		P[n][m][0] = 1.0;	// Initially, no servers busy with zero customers.
 	    }
 	}
-
-	for ( unsigned k = 1; k <= K; ++k ) {
-	    X[n][k] = 0.0;
-	}
     }
-
-    setMaxP();
 }
 
 
@@ -434,6 +306,99 @@ MVA::initialize()
 
 
 
+/*
+ * Accumulate the counts of a solver that did part of our work.
+ */
+
+void
+MVA::addCount( const MVA& lane )
+{
+    stepCount += lane.stepCount;
+    waitCount += lane.waitCount;
+    faultCount += lane.faultCount;
+}
+
+
+
+/*
+ * True if step() for one population does not use the results of the
+ * step before it, so populations can be solved in any order.
+ */
+
+bool
+MVA::hasIndependentSteps() const
+{
+    for ( unsigned m = 1; m <= M; ++m ) {
+	if ( Q[m]->hasHistory() || Q[m]->useStateProbabilities() ) return false;
+    }
+    return true;
+}
+
+
+
+/*
+ * The pool shared by all parallel solvers.  It is (re)created with
+ * __threads workers on demand.  Callers hold on to the pointer for as
+ * long as they use the pool, so a solver running on another thread
+ * when __threads changes keeps its old pool until it is done.
+ */
+
+static std::mutex __pool_mutex;
+static std::map<unsigned,std::shared_ptr<ThreadPool>> __pools;
+static std::shared_ptr<ThreadPool> __pool;
+
+std::shared_ptr<ThreadPool>
+MVA::threadPool()
+{
+    std::lock_guard<std::mutex> lock( __pool_mutex );
+    const unsigned n = __threads > 0 ? __threads : ThreadPool::hardware_concurrency();
+    if ( !__pool || __pool->size() != n ) {
+	__pool = std::make_shared<ThreadPool>( n );
+    }
+    return __pool;
+}
+
+
+/*
+ * A pool with a fixed number of workers (0 for all cores), for callers
+ * such as the Jacobi layering in lqns which run whole models in
+ * parallel and so must not depend on __threads.  One pool is kept for
+ * each size asked for.
+ */
+
+std::shared_ptr<ThreadPool>
+MVA::threadPool( const unsigned threads )
+{
+    std::lock_guard<std::mutex> lock( __pool_mutex );
+    const unsigned n = threads > 0 ? threads : ThreadPool::hardware_concurrency();
+    std::shared_ptr<ThreadPool>& pool = __pools[n];
+    if ( !pool ) {
+	pool = std::make_shared<ThreadPool>( n );
+    }
+    return pool;
+}
+
+
+
+/*
+ * Drop the pools without stopping their workers.  Must be called in
+ * the child after a fork(): the workers were not copied, so the pools
+ * can neither run tasks nor be joined.  The next call to threadPool()
+ * starts a new one.  The old pools are leaked.
+ */
+
+void
+MVA::forgetThreadPool()
+{
+    new std::shared_ptr<ThreadPool>( std::move( __pool ) );
+    for ( std::map<unsigned,std::shared_ptr<ThreadPool>>::iterator pool = __pools.begin(); pool != __pools.end(); ++pool ) {
+	new std::shared_ptr<ThreadPool>( std::move( pool->second ) );
+    }
+    __pools.clear();
+}
+
+
+
 /*
  * Step by priority.
  */
@@ -565,17 +530,13 @@ MVA::sumOf_L_m( const Server& station, const Population &N, const unsigned j ) c
     const unsigned m   = station.closedIndex;
     const unsigned E   = station.nEntries();
     const unsigned Nej = offset_e_j(N,j);					/* Hoist */
+    const double * L_m = L[Nej][m].row(1);
 
-    double sum = 0.0;
-    for ( unsigned k = 1; k <= K; ++k ) {
-	if ( station.priorityServer() && priority[k] < priority[j] ) continue;
-	const double scaling = tau_overlap( station, j, k, N );
-
-	for ( unsigned e = 1; e <= E; ++e ) {
-	    sum += L[Nej][m][e][k] * scaling;
-	}
+    if ( unitScaling( station ) && !station.priorityServer() ) {
+	return SIMD::sum( L_m, K * E );
+    } else {
+	return SIMD::dot( L_m, scaling( station, N, j, station.priorityServer() ), K * E );
     }
-    return sum;
 }
 
 
@@ -598,11 +559,23 @@ MVA::sumOf_SL_m( const Server& station, const Population &N, const unsigned j )
     const unsigned m   = station.closedIndex;
     const unsigned E   = station.nEntries();
     const unsigned Nej = offset_e_j(N,j);					/* Hoist */
+    const double * L_m = L[Nej][m].row(1);
+    const double * S_m = station.S_e(1);
 
-    double sum = 0.0;
+    double sum;
+    if ( unitScaling( station ) && !station.priorityServer() ) {
+	sum = SIMD::dot( S_m, L_m, K * E );
+    } else {
+	sum = SIMD::dot3( S_m, L_m, scaling( station, N, j, station.priorityServer() ), K * E );	/* BUG 145 */
+    }
+    if ( std::isfinite( sum ) ) return sum;
+
+    /* Find the first infinite service time, as before. */
+
+    sum = 0.0;
     for ( unsigned k = 1; k <= K; ++k ) {
 	if ( station.priorityServer() && priority[k] < priority[j] ) continue;
-	const double scaling = tau_overlap( station, j, k, N );			/* BUG 145 */
+	const double scaling = tau_overlap( station, j, k, N );
 
 	for ( unsigned e = 1; e <= E; ++e ) {
 	    const double s = station.S(e,k);
@@ -818,18 +791,13 @@ MVA::sumOf_U_m( const Server& station, const Population& N, const unsigned j ) c
     const unsigned m   = station.closedIndex;
     const unsigned E   = station.nEntries();
     const unsigned Nej = offset_e_j(N,j);					/* Hoist */
+    const double * U_m = U[Nej][m].row(1);
 
-    double sum = 0.0;
-
-    for ( unsigned k = 1; k <= K; ++k ) {
-	const double scaling = tau_overlap( station, j, k, N );
-
-	for ( unsigned e = 1; e <= E; ++e ) {
-	    sum += U[Nej][m][e][k] * scaling;
-	}
+    if ( unitScaling( station ) ) {
+	return SIMD::sum( U_m, K * E );
+    } else {
+	return SIMD::dot( U_m, scaling( station, N, j, false ), K * E );
     }
-
-    return sum;
 }
 
 
@@ -1589,6 +1557,41 @@ MVA::nrFactor( const Server& station, const unsigned e, const unsigned k ) const
  * Common expression: tau and overlap corrections
  */
 
+/*
+ * True if tau_overlap() is one for every class at station.
+ */
+
+bool
+MVA::unitScaling( const Server& station ) const
+{
+    return overlapFactor == nullptr && !( station.hasTau() && __bounds_limit > 0 );
+}
+
+
+
+/*
+ * tau_overlap() for each class k, repeated for every entry so that it
+ * lines up with the row of L, U or S for the station.  Classes of
+ * lower priority than j are zero if skip is set.  The storage belongs
+ * to the calling thread and is reused by the next call.
+ */
+
+const double *
+MVA::scaling( const Server& station, const Population& N, const unsigned j, const bool skip ) const
+{
+    static thread_local std::vector<double> w;
+
+    const unsigned E = station.nEntries();
+    w.resize( K * E );
+    for ( unsigned k = 1; k <= K; ++k ) {
+	const double s = ( skip && priority[k] < priority[j] ) ? 0.0 : tau_overlap( station, j, k, N );
+	std::fill( w.begin() + (k - 1) * E, w.begin() + k * E, s );
+    }
+    return w.data();
+}
+
+
+
 double
 MVA::tau_overlap( const Server& station, const unsigned j, const unsigned k, const Population& N ) const
 {
@@ -1936,34 +1939,168 @@ MVA::printStateP( std::ostream& output, const unsigned m, const Population& N )
 const char * const ExactMVA::__typeName = "Exact MVA";
 
 ExactMVA::ExactMVA( Vector<Server *>&q, const Population& N, const Vector<double>& z, const Vector<unsigned>& prio, const Vector<double>* of )
-    : MVA( q, N, z, prio, of), map(N)
+    : MVA( q, N, z, prio, of), map(N), levels(N), _byLevel(false), _master(nullptr), _lanes()
 {
 }
 
 
 /*
- * Recursively solve for population vector N starting at [0,0,...,0]
- * to nCust.  The dimensionality of N is limited by stack size...
+ * A lane for solving the populations of one level.  Storage is shared
+ * with the master (see solveLevels()).
+ */
+
+ExactMVA::ExactMVA( const ExactMVA * master )
+    : MVA( master->Q, master->NCust, master->thinkTime(), master->priority, master->overlapFactor ),
+      map(master->NCust), levels(master->NCust), _byLevel(true), _master(master), _lanes()
+{
+}
+
+
+ExactMVA::~ExactMVA()
+{
+    for ( std::vector<ExactMVA *>::const_iterator lane = _lanes.begin(); lane != _lanes.end(); ++lane ) {
+	delete *lane;
+    }
+}
+
+
+/*
+ * Solve for population vector N starting at [0,0,...,0] to NCust.
+ * If the steps only read the level below, only two levels of the
+ * population lattice are stored (see solveLevels()).  Otherwise, every
+ * population is stored and solved in the order of the map.
  */
 
 bool
 ExactMVA::solve()
 {
     /* Allocate array space and initialize */
+    _byLevel = canSolveByLevel();
     reset();				/* Reset all vectors to zero. */
-    dimension( map.dimension( NCust ).maxOffset() );
+    dimension( (_byLevel ? levels.dimension( NCust ) : map.dimension( NCust )).maxOffset() );
     clearCount();
 
     /* Let er rip! */
 
-    for ( PopulationMap::iterator n = map.begin(); n != map.end(); ++n ) {
-	step( *n );
+    if ( _byLevel ) {
+	solveLevels();
+    } else {
+	for ( PopulationMap::iterator n = map.begin(); n != map.end(); ++n ) {
+	    step( *n );
+	}
+    }
+    return true;
+}
+
+
+
+/*
+ * True if step(N) only reads the populations one level below N, so
+ * that solveLevels() can be used.  priorityInflation() reads U for
+ * populations further down, whose rows solveLevels() has reused, so
+ * priority servers need the full map.
+ */
+
+bool
+ExactMVA::canSolveByLevel() const
+{
+    if ( !hasIndependentSteps() ) return false;
+    for ( unsigned m = 1; m <= M; ++m ) {
+	if ( Q[m]->priorityServer() ) return false;
     }
     return true;
 }
 
 
 
+/*
+ * True if the populations of a level can be solved in parallel.
+ */
+
+bool
+ExactMVA::isParallel() const
+{
+    return _master == nullptr && __threads != 1 && K > 1;
+}
+
+
+
+/*
+ * Solve the populations level by level, where level l holds every
+ * population with l customers.  step(N) only reads the results for
+ * N-e_k, which are all one level down, so level l can reuse the rows
+ * of level l-2 and the populations of a level can be solved in
+ * parallel by the lanes.  Each population has its own row, so the
+ * results are the same as solving every population in turn.  Levels
+ * with one population, including NCust, are solved here so that the
+ * waiting times left in the stations are those of lane 0.
+ */
+
+void
+ExactMVA::solveLevels()
+{
+    const bool parallel = isParallel();
+    const std::shared_ptr<ThreadPool> pool = parallel ? threadPool() : nullptr;
+    if ( parallel ) {
+	while ( _lanes.size() < pool->size() ) {
+	    _lanes.push_back( new ExactMVA( this ) );
+	}
+	for ( std::vector<ExactMVA *>::const_iterator lane = _lanes.begin(); lane != _lanes.end(); ++lane ) {
+	    (*lane)->L = L;
+	    (*lane)->U = U;
+	    (*lane)->P = P;
+	    (*lane)->X = X;
+	    (*lane)->levels.dimension( NCust );
+	}
+	for ( unsigned m = 1; m <= M; ++m ) {
+	    Q[m]->setLanes( pool->size() );
+	}
+    }
+
+    clearRow( offset( Population( K ) ) );		/* Nobody home. */
+    for ( unsigned l = 1; l <= levels.levels(); ++l ) {
+	const size_t size = levels.size( l );
+	if ( !parallel || size == 1 ) {
+	    for ( size_t i = 0; i < size; ++i ) {
+		const Population N = levels.population( l, i );
+		clearRow( offset( N ) );
+		step( N );
+	    }
+	} else {
+	    pool->run( size, [&]( const size_t i, const unsigned w ) {
+		    Server::Lane lane_w( w );
+		    ExactMVA& lane = *_lanes[w];
+		    const Population N = lane.levels.population( l, i );
+		    lane.clearRow( lane.offset( N ) );
+		    lane.step( N );
+		} );
+	}
+    }
+
+    for ( std::vector<ExactMVA *>::const_iterator lane = _lanes.begin(); lane != _lanes.end(); ++lane ) {
+	addCount( **lane );
+	(*lane)->clearCount();
+    }
+}
+
+
+
+/*
+ * Return row n to its initial state.  It last held a population two
+ * levels down.
+ */
+
+void
+ExactMVA::clearRow( const unsigned n )
+{
+    L.fill( n, 0.0 );
+    U.fill( n, 0.0 );
+    X.fill( n, 0.0 );
+    P.reset( n );
+}
+
+
+
 /*
  * Compute the probabilities that servers are idle.  PB(N) == P(J,N)
  * is the probability that all servers are busy.  Subclasses assign
@@ -2075,6 +2212,8 @@ ExactMVA::priorityInflation( const Server& station, const Population &N, const u
     const unsigned E = station.nEntries();
     const unsigned n = offset(N);							/* Hoist */
     Probability util = 0.0;
+    Population N_hi(N);
+    Population N_lo(N);
 
     for ( unsigned k = 1; k <= K; ++k ) {
 	if ( priority[k] > priority[j] ) {
@@ -2082,12 +2221,12 @@ ExactMVA::priorityInflation( const Server& station, const Population &N, const u
 		if ( N[k] == 0 ) continue;
 		const double L_mk = L[n][m][e][k];
 		const Probability delta = fmod(L_mk,1.0);
-		Population N_hi(N);
-		Population N_lo(N);
-		N_lo[k] -= (unsigned)floor(L_mk);
-		N_hi[k] -= (unsigned)ceil(L_mk);
+		N_lo[k] = N[k] - (unsigned)floor(L_mk);
+		N_hi[k] = N[k] - (unsigned)ceil(L_mk);
 		util += (1.0 - delta) * U[offset(N_lo)][m][e][k] + delta * U[offset(N_hi)][m][e][k];
 	    }
+	    N_lo[k] = N[k];
+	    N_hi[k] = N[k];
 	}
     }
     return util;
@@ -2096,7 +2235,7 @@ ExactMVA::priorityInflation( const Server& station, const Population &N, const u
 /* ------------------------- Bard Schweitzer. ------------------------- */
 
 SchweitzerCommon::SchweitzerCommon( Vector<Server *>&q, const Population & N, const Vector<double>& z, const Vector<unsigned>& prio, const Vector<double>* of )
-    : MVA( q, N, z, prio, of), termination_test(1.0 / ( 4000 + 16 * N.sum() )), initialized(false), last_L(0)
+    : MVA( q, N, z, prio, of), termination_test(1.0 / ( 4000 + 16 * N.sum() )), initialized(false), last_L(0), _anderson()
 {
     last_L = new double ** [M+1];
     last_L[0] = 0;
@@ -2309,13 +2448,21 @@ SchweitzerCommon::initialize()
 
 
 /*
- * Core solver for Bard Schweitzer and Linearizer.
+ * Core solver for Bard Schweitzer and Linearizer.  If __anderson is
+ * set, the queue lengths are mixed by Anderson acceleration until the
+ * underrelaxation below starts.  Termination is tested on the residual
+ * of the plain step, and a step whose input was mixed is always
+ * followed by a plain one so that L, U, X and W agree on exit.
  */
 
 void
 SchweitzerCommon::core( const Population& N, const unsigned n )
 {
     unsigned i = 0;
+    double delta;
+    bool mixed = false;			/* L[n] came from accelerate()	*/
+    bool polish;			/* Last step started from a mix	*/
+    _anderson.reset( __anderson );
 
 #if DEBUG_MVA
     if ( debug_L || debug_P ) std::cout << "Initially..." << std::endl;
@@ -2355,7 +2502,10 @@ SchweitzerCommon::core( const Population& N, const unsigned n )
 	    }
 	}
 
-    } while ( max_delta_L( n, N ) >= termination_test );
+	polish = mixed;
+	delta = max_delta_L( n, N );
+	mixed = delta >= termination_test && _anderson.depth() > 0 && i <= 50 && accelerate( n, N );
+    } while ( delta >= termination_test || polish );
 
 #if DEBUG_MVA
     if ( debug_L ) {
@@ -2593,6 +2743,45 @@ SchweitzerCommon::max_delta_L( const unsigned n, const Population &N ) const
 
 
 
+/*
+ * Replace L[n] with the Anderson mix of the queue lengths going into
+ * (last_L) and coming out of the last step.  Return false if L[n] is
+ * left as is.
+ */
+
+bool
+SchweitzerCommon::accelerate( const unsigned n, const Population &N )
+{
+    std::vector<double> x;
+    std::vector<double> g;
+    for ( unsigned m = 1; m <= M; ++m ) {
+	const unsigned E = Q[m]->nEntries();
+	for ( unsigned e = 1; e <= E; ++e ) {
+	    for ( unsigned k = 1; k <= K; ++k ) {
+		if ( N[k] == 0 ) continue;
+		x.push_back( last_L[m][e][k] );
+		g.push_back( L[n][m][e][k] );
+	    }
+	}
+    }
+
+    if ( !_anderson.mix( x, g ) ) return false;
+
+    std::vector<double>::const_iterator l = g.begin();
+    for ( unsigned m = 1; m <= M; ++m ) {
+	const unsigned E = Q[m]->nEntries();
+	for ( unsigned e = 1; e <= E; ++e ) {
+	    for ( unsigned k = 1; k <= K; ++k ) {
+		if ( N[k] == 0 ) continue;
+		L[n][m][e][k] = *l++;
+	    }
+	}
+    }
+    return true;
+}
+
+
+
 /*
  * Inflation factor for priority MVA.
  */
@@ -2682,9 +2871,8 @@ Schweitzer::solve()
     clearCount();
 
     bool reset = !initialized;
-    reset = dimension( P, getMap().maxOffset() ) || reset;
+    reset = P.dimension( getMap().maxOffset(), Q ) || reset;
     if ( reset ) {
-	setMaxP();
 	initialize();
 	initialized = true;
     }
@@ -2725,10 +2913,9 @@ OneStepMVA::solve()
     clearCount();
 
     bool reset = !initialized;
-    reset = dimension( P, getMap().maxOffset() ) || reset;
+    reset = P.dimension( getMap().maxOffset(), Q ) || reset;
 
     if ( reset ) {
-	setMaxP();
 	initialize();
 	initialized = true;
     }
@@ -2749,40 +2936,14 @@ const char * const Linearizer::__typeName = "Linearizer";
  */
 
 Linearizer::Linearizer( Vector<Server *>&q, const Population & N, const Vector<double>& z, const Vector<unsigned>& prio, const Vector<double>* of )
-    : SchweitzerCommon( q, N, z, prio, of), c(0), map(N)
+    : SchweitzerCommon( q, N, z, prio, of), c(0), map(N, __threads != 1 && N.size() > 1), _master(nullptr), _lanes()
 {
     dimension( map.dimension( NCust ).maxOffset() );		/* Set up L, U, X and P */
 
     const size_t size = getMap().maxOffset();
-    saved_L.resize(size);
-    saved_U.resize(size);
-    saved_P.resize(size);
-
-    for ( unsigned n = 0; n < size; ++n ) {
-	saved_L[n] = new double ** [M+1];
-	saved_U[n] = new double ** [M+1];
-	saved_P[n] = new double *[M+1];
-
-	for ( unsigned m = 1; m <= M; ++m ) {
-	    const unsigned E = Q[m]->nEntries();
-
-	    saved_L[n][m] = new double * [E+1];
-	    saved_U[n][m] = new double * [E+1];
-	    saved_P[n][m] = 0;
-
-	    saved_L[n][m][0] = 0;
-	    saved_U[n][m][0] = 0;
-
-	    for ( unsigned e = 1; e <= E; ++e ) {
-		saved_L[n][m][e] = new double [K+1];
-		saved_U[n][m][e] = new double [K+1];
-		//No initialization needed, we only use what we save
-	    }
-	}
-    }
-
-    dimension( saved_P, size );		/* Allocate space for marginals */
-//    setMaxP();				/* Done in SchweitzerCommon     */
+    saved_L.dimension( size, Q, K );
+    saved_U.dimension( size, Q, K );
+    saved_P.dimension( size, Q );		/* Allocate space for marginals */
 
     D    = new double *** [M+1];
     D[0] = 0;
@@ -2811,30 +2972,30 @@ Linearizer::Linearizer( Vector<Server *>&q, const Population & N, const Vector<d
 
 
 /*
- * Free storage.
+ * Constructor for a lane.  A lane solves one of the populations N-e_c
+ * on behalf of its master.  It has its own c, last_L and counts, and
+ * shares everything else with the master (see alias()).
  */
 
-Linearizer::~Linearizer()
+Linearizer::Linearizer( const Linearizer * master )
+    : SchweitzerCommon( master->Q, master->NCust, master->thinkTime(), master->priority, master->overlapFactor ),
+      D(nullptr), c(0), map(master->NCust, master->map.isSplit()), _master(master), _lanes()
 {
-    const size_t size = getMap().maxOffset();
-    for ( unsigned n = 0; n < size; n++) {
-	for ( unsigned m = 1; m <= M; ++m ) {
-	    const unsigned E = Q[m]->nEntries();
-	    for ( unsigned e = 1; e <= E; ++e ) {
-		delete [] saved_L[n][m][e];
-		delete [] saved_U[n][m][e];
-	    }
-	    delete [] saved_L[n][m];
-	    delete [] saved_U[n][m];
+}
 
-	    if ( saved_P[n][m] ) {
-		delete [] saved_P[n][m];
-	    }
-	}
-	delete [] saved_L[n];
-	delete [] saved_U[n];
-	delete [] saved_P[n];
+
+
+/*
+ * Free storage.  A lane owns nothing but last_L; the arenas it
+ * shares are released by the last user.
+ */
+
+Linearizer::~Linearizer()
+{
+    for ( std::vector<Linearizer *>::const_iterator lane = _lanes.begin(); lane != _lanes.end(); ++lane ) {
+	delete *lane;
     }
+    if ( _master ) return;
 
     for ( unsigned m = 1; m <= M; ++m ) {
 	const unsigned E = Q[m]->nEntries();
@@ -2854,15 +3015,7 @@ void
 Linearizer::reset() 
 {
     SchweitzerCommon::reset();
-
-    const size_t size = getMap().maxOffset();
-    for ( unsigned n = 0; n < size; ++n ) {
-	for ( unsigned m = 1; m <= M; ++m ) {
-	    saved_P[n][m] = 0;
-	    saved_L[n][m][0] = 0;
-	    saved_U[n][m][0] = 0;
-	}
-    }
+    saved_P.clear();			/* Reinitialized by initialize() */
 
     D[0] = nullptr;
 
@@ -2907,12 +3060,20 @@ Linearizer::solve()
     estimate_P( NCust );
     initialized = true;
 
+    /*
+     * N-e_c for c > 0 can be solved at the same time if the map keeps
+     * their N-e_c-e_j apart and the stations don't need the results of
+     * the last step.  N is done first as the others need it.
+     */
+
+    const unsigned C = isParallel() ? 0 : K;
+
     for ( unsigned I = 1; I <= 2 ; ++I ) {
 
 	/*
 	 * NB: `c' is an instance variable used by our Lm function.
 	 */
-	for ( c = 0; c <= K; ++c ) {
+	for ( c = 0; c <= C; ++c ) {
 	    if ( c > 0 && NCust[c] == 0 ) continue;	/* NOP  BUG 345 */
 	    N = NCust;
 
@@ -2929,6 +3090,10 @@ Linearizer::solve()
 
 	}
 
+	if ( C < K ) {
+	    solveLanes();
+	}
+
 	c = 0;
 	update_Delta( NCust );
     }
@@ -2953,10 +3118,9 @@ Linearizer::initialize()
 
     bool reset = !initialized;
     const size_t size = getMap().maxOffset();
-    reset = dimension( P, size ) || reset;		/* Don't short circuit this!!! */
-    reset = dimension( saved_P, size ) || reset;
+    reset = P.dimension( size, Q ) || reset;		/* Don't short circuit this!!! */
+    reset = saved_P.dimension( size, Q ) || reset;
     if ( reset ) {
-	setMaxP();
 	SchweitzerCommon::initialize();
 	estimate_L( NCust );
 	estimate_P( NCust );
@@ -3031,6 +3195,91 @@ Linearizer::restore_L()
 }
 
 
+/*
+ * True if the populations N-e_c can be solved in parallel.
+ */
+
+bool
+Linearizer::isParallel() const
+{
+    return _master == nullptr && map.isSplit() && __threads != 1 && hasIndependentSteps();
+}
+
+
+
+/*
+ * Solve N-e_c, c = 1..K, using a lane per thread.  Each lane works on
+ * its own row of the split map, so the result is the same as the
+ * sequential loop in solve().
+ */
+
+void
+Linearizer::solveLanes()
+{
+    const std::shared_ptr<ThreadPool> pool = threadPool();
+    std::vector<unsigned> chains;
+    for ( unsigned k = 1; k <= K; ++k ) {
+	if ( NCust[k] > 0 ) {
+	    chains.push_back( k );	/* BUG 345 */
+	}
+    }
+
+    while ( _lanes.size() < pool->size() ) {
+	_lanes.push_back( newLane() );
+    }
+    for ( std::vector<Linearizer *>::const_iterator lane = _lanes.begin(); lane != _lanes.end(); ++lane ) {
+	(*lane)->alias( *this );
+	(*lane)->map.dimension( NCust );
+    }
+    for ( unsigned m = 1; m <= M; ++m ) {
+	Q[m]->setLanes( pool->size() );
+    }
+
+    pool->run( chains.size(), [&]( const size_t i, const unsigned w ) {
+	    Server::Lane lane_w( w );
+	    Linearizer& lane = *_lanes[w];
+	    Population N = NCust;
+
+	    lane.c = chains[i];
+	    N[lane.c] -= 1;
+
+	    lane.save_L();
+	    try {
+		lane.core( N, lane.offset_e_c_e_j(lane.c, 0) );	/* Hoist */
+	    }
+	    catch ( const MVA::iteration_limit& error ) {
+		/* Ignore iteration problems in lower level models */
+	    }
+	    lane.restore_L();
+	} );
+
+    for ( std::vector<Linearizer *>::const_iterator lane = _lanes.begin(); lane != _lanes.end(); ++lane ) {
+	addCount( **lane );
+	(*lane)->clearCount();
+    }
+}
+
+
+
+/*
+ * Share the master's storage.  Lanes only write rows of their own.
+ */
+
+void
+Linearizer::alias( const Linearizer& master )
+{
+    L = master.L;
+    U = master.U;
+    P = master.P;
+    X = master.X;
+    saved_L = master.saved_L;
+    saved_U = master.saved_U;
+    saved_P = master.saved_P;
+    D = master.D;
+}
+
+
+
 /*
  * Find Marginal Probabilities based on fraction `F' of class `k' jobs at
  * station for population `N'.  This routine corresponds to the
@@ -3204,11 +3453,7 @@ const char * const Linearizer2::__typeName = "Fast Linearizer";
 Linearizer2::Linearizer2( Vector<Server *>&q, const Population & N, const Vector<double>& z, const Vector<unsigned>& prio, const Vector<double>* of )
     : Linearizer( q, N, z, prio, of)
 {
-    Lm.resize(getMap().maxOffset());
-
-    for ( unsigned n = 0; n < getMap().maxOffset(); ++n ) {
-	Lm[n] = new double [M+1];
-    }
+    Lm.resize( getMap().maxOffset(), M+1 );
 
     D_k = new double ** [M+1];
     D_k[0] = nullptr;
@@ -3230,12 +3475,25 @@ Linearizer2::Linearizer2( Vector<Server *>&q, const Population & N, const Vector
 
 
 
+/*
+ * Constructor for a lane (see Linearizer).
+ */
+
+Linearizer2::Linearizer2( const Linearizer2 * master )
+    : Linearizer( master ), Lm(), D_k(nullptr)
+{
+}
+
+
+
 /*
  * Destructor...
  */
 
 Linearizer2::~Linearizer2()
 {
+    if ( _master ) return;
+
     for ( unsigned m = 1; m <= M; ++m ) {
 	const unsigned E = Q[m]->nEntries();
 	for ( unsigned e = 1; e <= E; ++e ) {
@@ -3244,10 +3502,6 @@ Linearizer2::~Linearizer2()
 	delete [] D_k[m];
     }
     delete [] D_k;
-
-    for ( unsigned n = 0; n < getMap().maxOffset(); ++n ) {
-	delete [] Lm[n];
-    }
 }
 
 
@@ -3292,6 +3546,20 @@ Linearizer2::update_Delta( const Population & N )
 
 
 
+/*
+ * Lanes share Lm and D_k too.
+ */
+
+void
+Linearizer2::alias( const Linearizer& master )
+{
+    Linearizer::alias( master );
+    Lm = dynamic_cast<const Linearizer2&>(master).Lm;
+    D_k = dynamic_cast<const Linearizer2&>(master).D_k;
+}
+
+
+
 /*
  * Pre-compute Lm and save.  S_L_m must be pre-computed because it relies
  * on the old value of L for all populations of N.  Therefore, we
@@ -300,16 +300,125 @@ FullPopulationMap::offset_e_j( const Population & N, const unsigned j ) const
 }
 
 
+LevelPopulationMap::LevelPopulationMap( const Population & N )
+    : PopulationMap( N ), _levels(0), _width(0), _count()
+{
+    dimension( N );
+}
+
+LevelPopulationMap::~LevelPopulationMap()
+{
+}
+
+
+/*
+ * Count the populations of each level and size the two levels kept.
+ */
+
+const PopulationMap&
+LevelPopulationMap::dimension( const Population& maxCust )
+{
+    assert( _dimN == maxCust.size() );
+    if ( !_count.empty() && _maxN == maxCust ) return *this;	/* Same population, keep the tables. */
+
+    _maxN = maxCust;
+    _levels = maxCust.sum();
+
+    /* Only the empty population follows class K. */
+
+    _count.assign( _dimN + 2, std::vector<size_t>( _levels + 1, 1 ) );
+    for ( unsigned i = _dimN; i > 0; --i ) {
+	for ( unsigned s = 0; s <= _levels; ++s ) {
+	    const size_t c = _count[i+1][s] - (s > maxCust[i] ? _count[i+1][s-maxCust[i]-1] : 0);
+	    _count[i][s] = c + (s > 0 ? _count[i][s-1] : 0);
+	}
+    }
+
+    _width = 0;
+    for ( unsigned l = 0; l <= _levels; ++l ) {
+	_width = std::max( _width, size( l ) );
+    }
+    _end = 2 * _width;
+    return *this;
+}
+
+
+
+unsigned
+LevelPopulationMap::offset_e_j( const Population & N, const unsigned j ) const
+{
+    assert( N[j] > 0 );
+    return position( N, j );
+}
+
+
+
+/*
+ * Return the offset of N less one customer of class j (none if j is
+ * zero).  Populations are numbered within their level in lexical
+ * order.
+ */
+
+unsigned
+LevelPopulationMap::position( const Population & N, const unsigned j ) const
+{
+    assert(N.size() == _dimN);
+    unsigned l = 0;
+    for ( unsigned i = 1; i <= _dimN; ++i ) {
+	l += N[i];
+    }
+    if ( j > 0 ) {
+	l -= 1;
+    }
+
+    size_t rank = 0;
+    unsigned r = l;
+    for ( unsigned i = 1; i <= _dimN; ++i ) {
+	const unsigned n = N[i] - (i == j ? 1 : 0);
+	rank += _count[i+1][r] - _count[i+1][r-n];	/* Same prefix, fewer of class i */
+	r -= n;
+    }
+    return (l & 1) * _width + rank;
+}
+
+
+
+/*
+ * Return population i of level l.
+ */
+
+Population
+LevelPopulationMap::population( const unsigned l, size_t i ) const
+{
+    assert( l <= _levels && i < size( l ) );
+    Population N( _dimN );
+    unsigned r = l;
+    for ( unsigned k = 1; k <= _dimN; ++k ) {
+	unsigned n = 0;
+	for ( ;; ) {
+	    const size_t c = count( k + 1, r - n );
+	    if ( i < c ) break;
+	    i -= c;
+	    n += 1;
+	}
+	N[k] = n;
+	r -= n;
+    }
+    return N;
+}
+
+
+
 //Only support the maximum customer configuration and the 
 //case of one less of each customer in the population.
-PartialPopulationMap::PartialPopulationMap( const Population & N ) 
-    : PopulationMap( N )
+PartialPopulationMap::PartialPopulationMap( const Population & N, const bool split ) 
+    : PopulationMap( N ), _split( split )
 {
     _stride.resize(_dimN);	//Index of offsets per class
     _end = 0;
     for ( unsigned j = _dimN; j > 0; --j ) {
 	_stride[j] = _end;
-	_end += (j + 1);
+	_end += split ? (_dimN + 1) : (j + 1);
     }
     _end += 1;
 }
@@ -388,6 +497,8 @@ PartialPopulationMap::offset_e_c_e_j( const unsigned c, const unsigned j ) const
 	
     if ( c == 0 && j == 0 ) {
 	i = _end - 1;		/* Special case - full population. */
+    } else if ( _split && c > 0 ) {
+	i = _stride[c] + j;	/* Row c is private to N-e_c */
     } else if ( c < j ) {
 	i = _stride[j] + c;
     } else {
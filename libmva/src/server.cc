@@ -37,6 +37,7 @@
  * ------------------------------------------------------------------------
  */
 
+#include <algorithm>
 #include <cstdlib>
 #include <cmath>
 #include <limits>
@@ -49,6 +50,9 @@
 #include "vector.h"
 
 //#define		DEBUG
+
+thread_local unsigned Server::__lane = 0;
+
 /* ----------------------- Helper Functions --------------------------- */
 
 /*
@@ -80,24 +84,20 @@ Server::initialize()
 	throw std::out_of_range( "Server::initialize -- phases" );
     }
 
-    W = new double ** [E+1];
     v = new double ** [E+1];
     s = new double ** [E+1];
 
     IL = new Probability * [E+1];
 
-    W[0] = 0;
     s[0] = 0;
     IL[0] = 0;
     for ( e = 1; e <= E; ++e ) {
 	v[e] = new double * [K+1];
-	W[e] = new double * [K+1];
 	s[e] = new double * [K+1];
 	IL[e] = new Probability[K+1];
 	for ( k = 0; k <= K; ++k ) {
 	    v[e][k] = new double [MAX_PHASES+1];
 	    s[e][k] = new double [P+1];
-	    W[e][k] = new double [MAX_PHASES+1];
 	    IL[e][k] = 0;
 
 	    unsigned p;
@@ -106,10 +106,12 @@ Server::initialize()
 	    }
 	    for ( p = 0; p <= MAX_PHASES; ++p ) {
 		v[e][k][p] = 0.0;
-		W[e][k][p] = 0.0;
 	    }
 	}
     }
+    _S_e.assign( (K + 1) * E, 0.0 );
+    _revision = 0;
+    W._lane.push_back( newWait() );
 
     /* v[0] is used to cache totals */
 
@@ -129,13 +131,14 @@ Server::initialize()
 
 Server::~Server()
 {
+    for ( std::vector<double ***>::const_iterator lane = W._lane.begin(); lane != W._lane.end(); ++lane ) {
+	deleteWait( *lane );
+    }
     for ( unsigned e = 1; e <= E; ++e ) {
 	for ( unsigned k = 0; k <= K; ++k ) {
-	    delete [] W[e][k];
 	    delete [] v[e][k];
 	    delete [] s[e][k];
 	}
-	delete [] W[e];
 	delete [] v[e];
 	delete [] s[e];
 	delete [] IL[e];
@@ -144,7 +147,6 @@ Server::~Server()
 	delete [] v[0][k];
     }
     delete [] v[0];
-    delete [] W;
     delete [] v;
     delete [] s;
     delete [] IL;
@@ -152,6 +154,66 @@ Server::~Server()
 
 
 
+/*
+ * Allocate and clear one lane of waiting times.
+ */
+
+double ***
+Server::newWait() const
+{
+    double *** w = new double ** [E+1];
+    w[0] = 0;
+    for ( unsigned e = 1; e <= E; ++e ) {
+	w[e] = new double * [K+1];
+	for ( unsigned k = 0; k <= K; ++k ) {
+	    w[e][k] = new double [MAX_PHASES+1];
+	    for ( unsigned p = 0; p <= MAX_PHASES; ++p ) {
+		w[e][k][p] = 0.0;
+	    }
+	}
+    }
+    return w;
+}
+
+
+void
+Server::deleteWait( double *** w ) const
+{
+    for ( unsigned e = 1; e <= E; ++e ) {
+	for ( unsigned k = 0; k <= K; ++k ) {
+	    delete [] w[e][k];
+	}
+	delete [] w[e];
+    }
+    delete [] w;
+}
+
+
+
+/*
+ * Make sure there are at least n lanes of waiting times.  Extra lanes
+ * are scratch space for parallel solvers and start off as copies of
+ * lane 0.
+ */
+
+void
+Server::setLanes( const unsigned n )
+{
+    while ( W._lane.size() < n ) {
+	double *** w = newWait();
+	for ( unsigned e = 1; e <= E; ++e ) {
+	    for ( unsigned k = 0; k <= K; ++k ) {
+		for ( unsigned p = 0; p <= MAX_PHASES; ++p ) {
+		    w[e][k][p] = W._lane[0][e][k][p];
+		}
+	    }
+	}
+	W._lane.push_back( w );
+    }
+}
+
+
+
 /*
  * This method is called before the MVA step for a given population.
  * Some server types need initialization.  By default, no operation.
@@ -182,6 +244,8 @@ Server::clear()
 	    }
 	}
     }
+    std::fill( _S_e.begin(), _S_e.end(), 0.0 );
+    _revision += 1;
 
     for ( unsigned k = 0; k <= K; ++k ) {
 	for ( unsigned p = 0; p <= MAX_PHASES; ++p ) {
@@ -201,6 +265,7 @@ Server::setService( const unsigned e, const unsigned k, const unsigned p, const
 {
     assert( k <= K && 0 < e && e <= E );
     setAndTotal( s[e][k], p, value );
+    cacheS( e, k );
     return *this;
 }
 
@@ -214,6 +279,7 @@ Server&
 Server::setVisits( const unsigned e, const unsigned k, const unsigned p, const double value )
 {
     assert( k <= K && 0 < e && e <= E && 0 < p && p <= MAX_PHASES && value >= 0.0);
+    if ( v[e][k][p] != value ) _revision += 1;
     v[e][k][p] = value;
     totalVisits( e, k );
     return *this;
@@ -229,6 +295,7 @@ Server&
 Server::addVisits( const unsigned e, const unsigned k, const unsigned p, const double value )
 {
     assert( k <= K && 0 < e && e <= E && 0 < p && p <= MAX_PHASES && value >= 0.0 );
+    if ( value != 0.0 ) _revision += 1;
     v[e][k][p] += value;
     totalVisits( e, k );
     return *this;
@@ -654,6 +721,7 @@ Server::operator*=( const double alpha )
 	    for ( unsigned p = 0; p <= P; ++p ) {
 		s[e][k][p] *= alpha;
 	    }
+	    cacheS( e, k );
 	}
     }
     return *this;
@@ -673,6 +741,7 @@ Server::operator/=( const double alpha )
 	    for ( unsigned p = 0; p <= P; ++p ) {
 		s[e][k][p] /= alpha;
 	    }
+	    cacheS( e, k );
 	}
     }
     return *this;
@@ -695,6 +764,7 @@ Server::operator=( const double alpha )
 		    s[e][k][p] = alpha;
 		}
 	    }
+	    cacheS( e, k );
 	}
 	/* Set waits for open classes */
 	for ( unsigned p = 0; p <= P; ++p ) {
@@ -0,0 +1,379 @@
+/*  -*- c++ -*-
+ * $Id$
+ *
+ * Vector kernels for the sumOf functions of the MVA solvers.  The x86
+ * kernels are compiled with target attributes so the library itself
+ * does not need -mavx2; they are only called if the processor has the
+ * instructions.  None are used unless chosen with SIMD::setISA().
+ *
+ * Copyright the Real-Time and Distributed Systems Group,
+ * Department of Systems and Computer Engineering,
+ * Carleton University, Ottawa, Ontario, Canada. K1S 5B6
+ *
+ * October 2026
+ *
+ * ------------------------------------------------------------------------
+ */
+
+#include <stdexcept>
+#include "simd.h"
+
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+#define HAVE_X86_KERNELS 1
+#include <immintrin.h>
+#endif
+
+/* ------------------------------ Serial ------------------------------ */
+
+/*
+ * The default for all rows, and for rows shorter than SIMD::threshold
+ * with the other kernels.
+ */
+
+static double
+sum_serial( const double * x, const size_t n )
+{
+    double sum = 0.0;
+    for ( size_t i = 0; i < n; ++i ) {
+	sum += x[i];
+    }
+    return sum;
+}
+
+
+static double
+dot_serial( const double * x, const double * y, const size_t n )
+{
+    double sum = 0.0;
+    for ( size_t i = 0; i < n; ++i ) {
+	sum += x[i] * y[i];
+    }
+    return sum;
+}
+
+
+static double
+dot3_serial( const double * x, const double * y, const double * z, const size_t n )
+{
+    double sum = 0.0;
+    for ( size_t i = 0; i < n; ++i ) {
+	sum += x[i] * y[i] * z[i];
+    }
+    return sum;
+}
+
+/* ------------------------------ Scalar ------------------------------ */
+
+/*
+ * Every kernel below keeps SIMD::lanes partial sums, lane k taking
+ * x[i] for i % lanes == k, folds them with fold(), then adds the tail
+ * in order.  The vector kernels only hold the lanes in registers, so
+ * all of them give the same result as these, bit for bit.
+ */
+
+static double
+fold( const double * a )
+{
+    return ((a[0] + a[4]) + (a[1] + a[5])) + ((a[2] + a[6]) + (a[3] + a[7]));
+}
+
+
+static double
+sum_scalar( const double * x, const size_t n )
+{
+    double a[SIMD::lanes] = { 0.0 };
+    size_t i = 0;
+    for ( ; i + SIMD::lanes <= n; i += SIMD::lanes ) {
+	for ( size_t k = 0; k < SIMD::lanes; ++k ) {
+	    a[k] += x[i+k];
+	}
+    }
+    double sum = fold( a );
+    for ( ; i < n; ++i ) {
+	sum += x[i];
+    }
+    return sum;
+}
+
+
+static double
+dot_scalar( const double * x, const double * y, const size_t n )
+{
+    double a[SIMD::lanes] = { 0.0 };
+    size_t i = 0;
+    for ( ; i + SIMD::lanes <= n; i += SIMD::lanes ) {
+	for ( size_t k = 0; k < SIMD::lanes; ++k ) {
+	    a[k] += x[i+k] * y[i+k];
+	}
+    }
+    double sum = fold( a );
+    for ( ; i < n; ++i ) {
+	sum += x[i] * y[i];
+    }
+    return sum;
+}
+
+
+static double
+dot3_scalar( const double * x, const double * y, const double * z, const size_t n )
+{
+    double a[SIMD::lanes] = { 0.0 };
+    size_t i = 0;
+    for ( ; i + SIMD::lanes <= n; i += SIMD::lanes ) {
+	for ( size_t k = 0; k < SIMD::lanes; ++k ) {
+	    a[k] += x[i+k] * y[i+k] * z[i+k];
+	}
+    }
+    double sum = fold( a );
+    for ( ; i < n; ++i ) {
+	sum += x[i] * y[i] * z[i];
+    }
+    return sum;
+}
+
+#if HAVE_X86_KERNELS
+/* ------------------------------- SSE2 ------------------------------- */
+
+/*
+ * Four registers of two lanes: s0 and s2 hold lanes 0-1 and 4-5, s1
+ * and s3 lanes 2-3 and 6-7, so adding s0+s2 and s1+s3 starts fold().
+ */
+
+__attribute__((target("sse2"))) static double
+horizontal( const __m128d s0, const __m128d s1, const __m128d s2, const __m128d s3 )
+{
+    double u[2];
+    double v[2];
+    _mm_storeu_pd( u, _mm_add_pd( s0, s2 ) );
+    _mm_storeu_pd( v, _mm_add_pd( s1, s3 ) );
+    return (u[0] + u[1]) + (v[0] + v[1]);
+}
+
+
+__attribute__((target("sse2"))) static double
+sum_sse2( const double * x, const size_t n )
+{
+    __m128d s0 = _mm_setzero_pd();
+    __m128d s1 = _mm_setzero_pd();
+    __m128d s2 = _mm_setzero_pd();
+    __m128d s3 = _mm_setzero_pd();
+    size_t i = 0;
+    for ( ; i + SIMD::lanes <= n; i += SIMD::lanes ) {
+	s0 = _mm_add_pd( s0, _mm_loadu_pd( x + i ) );
+	s1 = _mm_add_pd( s1, _mm_loadu_pd( x + i + 2 ) );
+	s2 = _mm_add_pd( s2, _mm_loadu_pd( x + i + 4 ) );
+	s3 = _mm_add_pd( s3, _mm_loadu_pd( x + i + 6 ) );
+    }
+    double sum = horizontal( s0, s1, s2, s3 );
+    for ( ; i < n; ++i ) {
+	sum += x[i];
+    }
+    return sum;
+}
+
+
+__attribute__((target("sse2"))) static double
+dot_sse2( const double * x, const double * y, const size_t n )
+{
+    __m128d s0 = _mm_setzero_pd();
+    __m128d s1 = _mm_setzero_pd();
+    __m128d s2 = _mm_setzero_pd();
+    __m128d s3 = _mm_setzero_pd();
+    size_t i = 0;
+    for ( ; i + SIMD::lanes <= n; i += SIMD::lanes ) {
+	s0 = _mm_add_pd( s0, _mm_mul_pd( _mm_loadu_pd( x + i ), _mm_loadu_pd( y + i ) ) );
+	s1 = _mm_add_pd( s1, _mm_mul_pd( _mm_loadu_pd( x + i + 2 ), _mm_loadu_pd( y + i + 2 ) ) );
+	s2 = _mm_add_pd( s2, _mm_mul_pd( _mm_loadu_pd( x + i + 4 ), _mm_loadu_pd( y + i + 4 ) ) );
+	s3 = _mm_add_pd( s3, _mm_mul_pd( _mm_loadu_pd( x + i + 6 ), _mm_loadu_pd( y + i + 6 ) ) );
+    }
+    double sum = horizontal( s0, s1, s2, s3 );
+    for ( ; i < n; ++i ) {
+	sum += x[i] * y[i];
+    }
+    return sum;
+}
+
+
+__attribute__((target("sse2"))) static __m128d
+mul3( const double * x, const double * y, const double * z )
+{
+    return _mm_mul_pd( _mm_mul_pd( _mm_loadu_pd( x ), _mm_loadu_pd( y ) ), _mm_loadu_pd( z ) );
+}
+
+
+__attribute__((target("sse2"))) static double
+dot3_sse2( const double * x, const double * y, const double * z, const size_t n )
+{
+    __m128d s0 = _mm_setzero_pd();
+    __m128d s1 = _mm_setzero_pd();
+    __m128d s2 = _mm_setzero_pd();
+    __m128d s3 = _mm_setzero_pd();
+    size_t i = 0;
+    for ( ; i + SIMD::lanes <= n; i += SIMD::lanes ) {
+	s0 = _mm_add_pd( s0, mul3( x + i, y + i, z + i ) );
+	s1 = _mm_add_pd( s1, mul3( x + i + 2, y + i + 2, z + i + 2 ) );
+	s2 = _mm_add_pd( s2, mul3( x + i + 4, y + i + 4, z + i + 4 ) );
+	s3 = _mm_add_pd( s3, mul3( x + i + 6, y + i + 6, z + i + 6 ) );
+    }
+    double sum = horizontal( s0, s1, s2, s3 );
+    for ( ; i < n; ++i ) {
+	sum += x[i] * y[i] * z[i];
+    }
+    return sum;
+}
+
+/* ------------------------------- AVX2 ------------------------------- */
+
+/*
+ * Two registers of four lanes: s0 holds lanes 0-3 and s1 lanes 4-7.
+ * No FMA so the products are rounded as in the scalar code.
+ */
+
+__attribute__((target("avx2"))) static double
+horizontal( const __m256d s0, const __m256d s1 )
+{
+    double t[4];
+    _mm256_storeu_pd( t, _mm256_add_pd( s0, s1 ) );
+    return (t[0] + t[1]) + (t[2] + t[3]);
+}
+
+
+__attribute__((target("avx2"))) static double
+sum_avx2( const double * x, const size_t n )
+{
+    __m256d s0 = _mm256_setzero_pd();
+    __m256d s1 = _mm256_setzero_pd();
+    size_t i = 0;
+    for ( ; i + SIMD::lanes <= n; i += SIMD::lanes ) {
+	s0 = _mm256_add_pd( s0, _mm256_loadu_pd( x + i ) );
+	s1 = _mm256_add_pd( s1, _mm256_loadu_pd( x + i + 4 ) );
+    }
+    double sum = horizontal( s0, s1 );
+    for ( ; i < n; ++i ) {
+	sum += x[i];
+    }
+    return sum;
+}
+
+
+__attribute__((target("avx2"))) static double
+dot_avx2( const double * x, const double * y, const size_t n )
+{
+    __m256d s0 = _mm256_setzero_pd();
+    __m256d s1 = _mm256_setzero_pd();
+    size_t i = 0;
+    for ( ; i + SIMD::lanes <= n; i += SIMD::lanes ) {
+	s0 = _mm256_add_pd( s0, _mm256_mul_pd( _mm256_loadu_pd( x + i ), _mm256_loadu_pd( y + i ) ) );
+	s1 = _mm256_add_pd( s1, _mm256_mul_pd( _mm256_loadu_pd( x + i + 4 ), _mm256_loadu_pd( y + i + 4 ) ) );
+    }
+    double sum = horizontal( s0, s1 );
+    for ( ; i < n; ++i ) {
+	sum += x[i] * y[i];
+    }
+    return sum;
+}
+
+
+__attribute__((target("avx2"))) static double
+dot3_avx2( const double * x, const double * y, const double * z, const size_t n )
+{
+    __m256d s0 = _mm256_setzero_pd();
+    __m256d s1 = _mm256_setzero_pd();
+    size_t i = 0;
+    for ( ; i + SIMD::lanes <= n; i += SIMD::lanes ) {
+	s0 = _mm256_add_pd( s0, _mm256_mul_pd( _mm256_mul_pd( _mm256_loadu_pd( x + i ), _mm256_loadu_pd( y + i ) ), _mm256_loadu_pd( z + i ) ) );
+	s1 = _mm256_add_pd( s1, _mm256_mul_pd( _mm256_mul_pd( _mm256_loadu_pd( x + i + 4 ), _mm256_loadu_pd( y + i + 4 ) ), _mm256_loadu_pd( z + i + 4 ) ) );
+    }
+    double sum = horizontal( s0, s1 );
+    for ( ; i < n; ++i ) {
+	sum += x[i] * y[i] * z[i];
+    }
+    return sum;
+}
+#endif
+
+/* ----------------------------- Dispatch ----------------------------- */
+
+const SIMD::Kernels SIMD::__serial = { &sum_serial, &dot_serial, &dot3_serial };
+static const SIMD::Kernels scalar_kernels = { &sum_scalar, &dot_scalar, &dot3_scalar };
+const SIMD::Kernels * SIMD::__kernels = &SIMD::__serial;
+SIMD::ISA SIMD::__isa = SIMD::ISA::SERIAL;
+
+#if HAVE_X86_KERNELS
+static const SIMD::Kernels sse2_kernels = { &sum_sse2, &dot_sse2, &dot3_sse2 };
+static const SIMD::Kernels avx2_kernels = { &sum_avx2, &dot_avx2, &dot3_avx2 };
+#endif
+
+bool
+SIMD::supports( const ISA isa )
+{
+#if HAVE_X86_KERNELS
+    __builtin_cpu_init();		/* May run before libgcc's own initializer. */
+#endif
+    switch ( isa ) {
+    case ISA::SERIAL:
+    case ISA::SCALAR: return true;
+#if HAVE_X86_KERNELS
+    case ISA::SSE2: return __builtin_cpu_supports( "sse2" );
+    case ISA::AVX2: return __builtin_cpu_supports( "avx2" );
+#endif
+    default: return false;
+    }
+}
+
+
+/*
+ * The widest instruction set the processor supports.  Not the default;
+ * see simd.h.
+ */
+
+SIMD::ISA
+SIMD::best()
+{
+    if ( supports( ISA::AVX2 ) ) return ISA::AVX2;
+    else if ( supports( ISA::SSE2 ) ) return ISA::SSE2;
+    else return ISA::SCALAR;
+}
+
+
+/*
+ * The kernels for isa.  Throws if the processor does not support it.
+ */
+
+const SIMD::Kernels&
+SIMD::kernels( const ISA isa )
+{
+    if ( !supports( isa ) ) throw std::invalid_argument( name( isa ) );
+    switch ( isa ) {
+#if HAVE_X86_KERNELS
+    case ISA::SSE2: return sse2_kernels;
+    case ISA::AVX2: return avx2_kernels;
+#endif
+    case ISA::SCALAR: return scalar_kernels;
+    default: return __serial;
+    }
+}
+
+
+/*
+ * Use the kernels for isa.  Not to be called while a solver is running.
+ */
+
+void
+SIMD::setISA( const ISA isa )
+{
+    __kernels = &kernels( isa );
+    __isa = isa;
+}
+
+
+const char *
+SIMD::name( const ISA isa )
+{
+    switch ( isa ) {
+    case ISA::SSE2: return "sse2";
+    case ISA::AVX2: return "avx2";
+    case ISA::SCALAR: return "scalar";
+    default: return "serial";
+    }
+}
@@ -0,0 +1,162 @@
+/*  -*- c++ -*-
+ * $Id$
+ *
+ * Thread pool for the parallel solvers.
+ *
+ * Copyright the Real-Time and Distributed Systems Group,
+ * Department of Systems and Computer Engineering,
+ * Carleton University, Ottawa, Ontario, Canada. K1S 5B6
+ *
+ * October 2026
+ *
+ * ------------------------------------------------------------------------
+ */
+
+#include <algorithm>
+#include "threadpool.h"
+
+thread_local bool ThreadPool::__inside = false;
+
+/*
+ * Start n-1 workers; the caller of run() is the n'th.
+ */
+
+ThreadPool::ThreadPool( const unsigned n )
+    : _threads(), _run(), _mutex(), _start(), _done(), _task(nullptr), _n(0), _next(0),
+      _busy(0), _generation(0), _stop(false), _error(), _fp_flags(0), _fenv()
+{
+    for ( unsigned i = 1; i < n; ++i ) {
+	_threads.emplace_back( &ThreadPool::worker, this, i );
+    }
+}
+
+
+/*
+ * Stop and join the workers.
+ */
+
+ThreadPool::~ThreadPool()
+{
+    {
+	std::lock_guard<std::mutex> lock( _mutex );
+	_stop = true;
+    }
+    _start.notify_all();
+    for ( std::vector<std::thread>::iterator thread = _threads.begin(); thread != _threads.end(); ++thread ) {
+	thread->join();
+    }
+}
+
+
+
+/*
+ * Number of threads to use when the user does not say.
+ */
+
+unsigned
+ThreadPool::hardware_concurrency()
+{
+    return std::max( std::thread::hardware_concurrency(), 1U );
+}
+
+
+
+/*
+ * Run task(i,w) for i in [0,n).  Returns when all tasks are done.
+ */
+
+void
+ThreadPool::run( const size_t n, const task_t& task )
+{
+    if ( n == 0 ) return;
+    if ( __inside || _threads.empty() || n == 1 ) {
+	for ( size_t i = 0; i < n; ++i ) {
+	    task( i, 0 );
+	}
+	return;
+    }
+
+    std::lock_guard<std::mutex> serialize( _run );
+    {
+	std::lock_guard<std::mutex> lock( _mutex );
+	_task = &task;
+	_n = n;
+	_next = 0;
+	_busy = _threads.size();
+	_error = nullptr;
+	_fp_flags = 0;
+	std::fegetenv( &_fenv );
+	_generation += 1;
+    }
+    _start.notify_all();
+
+    execute( 0 );
+
+    std::unique_lock<std::mutex> lock( _mutex );
+    _done.wait( lock, [this]{ return _busy == 0; } );
+    _task = nullptr;
+    if ( _fp_flags != 0 ) {
+	std::feraiseexcept( _fp_flags );
+    }
+    if ( _error ) {
+	std::rethrow_exception( _error );
+    }
+}
+
+
+
+/*
+ * Worker thread.  Wait for a new generation, then run tasks.
+ */
+
+void
+ThreadPool::worker( const unsigned w )
+{
+    unsigned long generation = 0;
+    for ( ;; ) {
+	{
+	    std::unique_lock<std::mutex> lock( _mutex );
+	    _start.wait( lock, [&]{ return _stop || _generation != generation; } );
+	    if ( _stop ) return;
+	    generation = _generation;
+	}
+	std::fesetenv( &_fenv );
+	std::feclearexcept( FE_ALL_EXCEPT );
+
+	execute( w );
+
+	const int flags = std::fetestexcept( FE_ALL_EXCEPT );
+	std::lock_guard<std::mutex> lock( _mutex );
+	_fp_flags |= flags;
+	_busy -= 1;
+	if ( _busy == 0 ) {
+	    _done.notify_all();
+	}
+    }
+}
+
+
+
+/*
+ * Pull tasks until there are none left.  Once a task has failed, the
+ * remaining ones are skipped.
+ */
+
+void
+ThreadPool::execute( const unsigned w )
+{
+    __inside = true;
+    for ( size_t i = _next++; i < _n; i = _next++ ) {
+	try {
+	    (*_task)( i, w );
+	}
+	catch ( ... ) {
+	    std::lock_guard<std::mutex> lock( _mutex );
+	    if ( !_error ) {
+		_error = std::current_exception();
+	    }
+	    _next = _n;
+	}
+    }
+    __inside = false;
+}
@@ -50,10 +50,10 @@ namespace LQIO {
     lqio_params_stats io_vars(VERSION,nullptr);
 
     namespace DOM {
-	Document* __document = nullptr;
+	thread_local Document* __document = nullptr;
 	bool Document::__debugXML = false;
 	bool Document::__debugJSON = false;
-	std::string Document::__input_file_name = "";
+	thread_local std::string Document::__input_file_name = "";
 	const char * Document::XConvergence = "conv_val";			/* Matches schema. 	*/
 	const char * Document::XIterationLimit = "it_limit";			/* Matched schema.	*/
 	const char * Document::XPrintInterval = "print_int";			/* Matches schema.	*/
@@ -1093,13 +1093,14 @@ namespace LQIO {
 	}
     }
     
+    thread_local unsigned lqio_params_stats::error_count = 0;
+
     lqio_params_stats::lqio_params_stats( const char * version, void (*action)(error_severity) ) :
 	lq_toolname(),
 	lq_version(version),
 	lq_command_line(),
 	severity_action(action),
 	max_error(10),
-	error_count(0),
 	severity_level(LQIO::error_severity::ALL)
     {
     }
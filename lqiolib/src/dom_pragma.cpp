@@ -179,8 +179,10 @@ namespace LQIO {
 	const char * Pragma::_abort_all_ =			"abort-all";		// Quorum
 	const char * Pragma::_abort_local_ =			"abort-local";		// Quorum
 	const char * Pragma::_abort_remote_ =			"abort-remote";		// Quorum
+	const char * Pragma::_adaptive_ =			"adaptive";		// relaxation
 	const char * Pragma::_advisory_ =			"advisory";
 	const char * Pragma::_all_ =				"all";
+	const char * Pragma::_anderson_ =			"anderson";		// relaxation
 	const char * Pragma::_batched_ =			"batched";
 	const char * Pragma::_batched_back_ =			"batched-back";
 	const char * Pragma::_bcmp_ =				"bcmp";			// BUG 270
@@ -189,6 +191,7 @@ namespace LQIO {
 	const char * Pragma::_bruell_ =				"bruell";		// multiserver
 	const char * Pragma::_convergence_value_ =		"convergence-value";
 	const char * Pragma::_conway_ =				"conway";		// multiserver
+	const char * Pragma::_conway_limit_ =			"conway-limit";
 	const char * Pragma::_custom_ =				"custom";		// multiserver
 	const char * Pragma::_custom_natural_ =			"custom-natural";
 	const char * Pragma::_cycles_ =				"cycles";
@@ -204,6 +207,7 @@ namespace LQIO {
 	const char * Pragma::_extended_ =			"extended";		// BUG 270
 	const char * Pragma::_false_ =				"false";
 	const char * Pragma::_fast_ =				"fast-linearizer";
+	const char * Pragma::_fixed_ =				"fixed";		// relaxation
 	const char * Pragma::_fixed_rate_ =			"fixed-rate";
 	const char * Pragma::_force_infinite_ =			"force-infinite";
 	const char * Pragma::_force_multiserver_ =		"force-multiserver";
@@ -218,6 +222,7 @@ namespace LQIO {
 	const char * Pragma::_initial_loops_ =			"initial-loops";
 	const char * Pragma::_interlocking_ =			"interlocking";
 	const char * Pragma::_iteration_limit_ =		"iteration-limit";
+	const char * Pragma::_jacobi_ =				"jacobi";
 	const char * Pragma::_join_delay_ =			"join-delay";		// Quorum
 	const char * Pragma::_keep_all_ =			"keep-all";		// Quorum
 	const char * Pragma::_layering_ =			"layering";
@@ -232,6 +237,8 @@ namespace LQIO {
 	const char * Pragma::_multiserver_ =			"multiserver";
 	const char * Pragma::_multiservers_ =			"multiservers";
 	const char * Pragma::_mva_ =				"mva";
+	const char * Pragma::_mva_anderson_ =			"mva-anderson";
+	const char * Pragma::_mva_threads_ =			"mva-threads";
 	const char * Pragma::_nice_ =				"nice";
 	const char * Pragma::_no_ =				"no";
 	const char * Pragma::_no_entry_ =			"no-entry";
@@ -252,6 +259,7 @@ namespace LQIO {
 	const char * Pragma::_quorum_reply_ =			"quorum-reply";		// Quorum
 	const char * Pragma::_reiser_ =				"reiser";		// multiserver, hvfcfs BUG_471
 	const char * Pragma::_reiser_ps_ =			"reiser-ps";		// multiserver
+	const char * Pragma::_relaxation_ =			"relaxation";
 	const char * Pragma::_replication_ =			"replication";
 	const char * Pragma::_reschedule_on_async_send_ =	"reschedule-on-async-send";
 	const char * Pragma::_rolia_ =				"rolia";		// multiserver
@@ -263,6 +271,7 @@ namespace LQIO {
 	const char * Pragma::_schweitzer_ =			"schweitzer";
 	const char * Pragma::_seed_value_ =			"seed-value";
 	const char * Pragma::_severity_level_ =			"severity-level";
+	const char * Pragma::_skip_converged_ =		"skip-converged";
 	const char * Pragma::_share_ =				"share";
 	const char * Pragma::_srvn_ =				"srvn";
         const char * Pragma::_simple_ =                         "simple";
@@ -272,6 +281,7 @@ namespace LQIO {
         const char * Pragma::_spex_header_ =                    "spex-header";
         const char * Pragma::_spex_iteration_limit_ =           "spex-iteration-limit";
         const char * Pragma::_spex_underrelaxation_ =           "spex-underrelaxation";
+        const char * Pragma::_split_submodels_ =		"split-submodels";
         const char * Pragma::_squashed_ =                       "squashed";
 	const char * Pragma::_stochastic_ =			"stochastic";
 	const char * Pragma::_stop_on_bogus_utilization_ =	"stop-on-bogus-utilization";
@@ -285,6 +295,7 @@ namespace LQIO {
 	const char * Pragma::_true_ =				"true";
 	const char * Pragma::_underrelaxation_ =		"underrelaxation";
 	const char * Pragma::_variance_ =			"variance";
+	const char * Pragma::_warm_start_ =			"warm-start";
 	const char * Pragma::_warning_ =			"warning";
 	const char * Pragma::_yes_ =				"yes";
 	const char * Pragma::_zhou_ =				"zhou";			// multiserver 
@@ -294,7 +305,7 @@ namespace LQIO {
 	const std::set<std::string> Pragma::__bcmp_args = { _lqn_, _extended_, _true_, _yes_, _false_, _no_, "t", "y", "f", "n", "" };
 	const std::set<std::string> Pragma::__force_infinite_args = { _none_, _fixed_rate_, _multiservers_, _all_, "" };
 	const std::set<std::string> Pragma::__force_multiserver_args = { _none_, _processors_, _tasks_, _all_, "" };
-	const std::set<std::string> Pragma::__layering_args = { _batched_, _batched_back_, _mol_, _mol_back_, _processor_, _share_, _squashed_, _srvn_, _hwsw_ };
+	const std::set<std::string> Pragma::__layering_args = { _batched_, _batched_back_, _jacobi_, _mol_, _mol_back_, _processor_, _share_, _squashed_, _srvn_, _hwsw_ };
 	const std::set<std::string> Pragma::__hvfcfs_args = { _eager_, _reiser_ };	/* BUG_471 */
 	const std::set<std::string> Pragma::__multiserver_args = { _bruell_, _conway_, _default_, _experimental_, _reiser_, _reiser_ps_, _rolia_, _rolia_ps_, _schmidt_, _suri_, _zhou_ };
 	const std::set<std::string> Pragma::__mva_args = { _bounds_, _exact_, _linearizer_, _schweitzer_, _fast_, _one_step_, _one_step_linearizer_ };
@@ -303,6 +314,7 @@ namespace LQIO {
 	const std::set<std::string> Pragma::__quorum_delayed_calls_args = { _keep_all_, _abort_all_, _abort_local_, _abort_remote_ };
 	const std::set<std::string> Pragma::__quorum_distribution_args = { _threepoint_, _gamma_, _geometric_, _deterministic_ };
 	const std::set<std::string> Pragma::__quorum_idle_time_args = { _default_, _join_delay_ };
+	const std::set<std::string> Pragma::__relaxation_args = { _adaptive_, _anderson_, _fixed_ };
 	const std::set<std::string> Pragma::__replication_args = { _expand_, _prune_, _pan_ };
 	const std::set<std::string> Pragma::__scheduling_model_args = { _default_, _default_natural_, _custom_, _custom_natural_ };
 	const std::set<std::string> Pragma::__task_args = { _default_, SCHEDULE::DELAY, SCHEDULE::FIFO, SCHEDULE::HOL, SCHEDULE::RAND };
@@ -317,6 +329,7 @@ namespace LQIO {
 	    { _bcmp_,			    &__true_false_arg },	    /* lqns */
 	    { _block_period_,      	    nullptr },			    /* lqsim */
 	    { _convergence_value_,	    nullptr },			    /* lqns */
+	    { _conway_limit_,		    nullptr },			    /* lqns */
 	    { _cycles_,  	    	    &__true_false_arg },	    /* lqns */
 	    { _default_output_,		    &__true_false_arg },	    /* all */
 	    { _force_infinite_,		    &__force_infinite_args },	    /* */
@@ -332,6 +345,8 @@ namespace LQIO {
 	    { _mol_underrelaxation_,	    nullptr },			    /* lqns */
 	    { _multiserver_,  	    	    &__multiserver_args },	    /* lqns */
 	    { _mva_,  		   	    &__mva_args },		    /* lqns */
+	    { _mva_anderson_,		    nullptr },			    /* lqns, qnsolver */
+	    { _mva_threads_,		    nullptr },			    /* lqns, qnsolver */
 	    { _nice_,              	    nullptr },			    /* lqsim */
 	    { _overtaking_,  	    	    &__overtaking_args },	    /* lqns */
 	    { _precision_,  	    	    nullptr },			    /* lqsim */
@@ -343,24 +358,28 @@ namespace LQIO {
 	    { _quorum_idle_time_,  	    &__quorum_idle_time_args },     /* lqns */
 	    { _quorum_reply_, 		    &__true_false_arg },	    /* lqsim */
 	    { _reschedule_on_async_send_,   &__true_false_arg },
+	    { _relaxation_,		    &__relaxation_args },	    /* lqns */
 	    { _replication_,		    &__replication_args },	    /* lqns */
 	    { _run_time_,  	    	    nullptr },			    /* lqsim */
 	    { _save_marginal_probabilities_,&__true_false_arg },
 	    { _scheduling_model_,  	    &__scheduling_model_args },
 	    { _seed_value_,  	    	    nullptr },			    /* lqsim */
 	    { _severity_level_,  	    &__warning_args },
+	    { _skip_converged_,		    nullptr },			    /* lqns */
 	    { _spex_comment_,		    &__true_false_arg },
 	    { _spex_convergence_,	    nullptr },			    /* BUG 422 */
 	    { _spex_header_,  		    &__true_false_arg },
 	    { _spex_iteration_limit_,	    nullptr },			    /* BUG 422 */
 	    { _spex_underrelaxation_,	    nullptr },			    /* BUG 422 */
+	    { _split_submodels_,	    &__true_false_arg },	    /* lqns */
 	    { _stop_on_bogus_utilization_,  nullptr },			    /* lqns */
 	    { _stop_on_message_loss_,  	    &__true_false_arg },
 	    { _task_scheduling_,  	    &__task_args },
 	    { _tau_,               	    nullptr },			    /* lqns */
 	    { _threads_,  		    &__threads_args },		    /* lqns */
 	    { _underrelaxation_,	    nullptr },			    /* lqns */
-	    { _variance_,  		    &__variance_args }		    /* lqns */
+	    { _variance_,  		    &__variance_args },		    /* lqns */
+	    { _warm_start_,  		    &__true_false_arg }		    /* lqns */
 	};
 	
     }
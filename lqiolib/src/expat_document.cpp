@@ -534,13 +534,35 @@ namespace LQIO {
 						XML::getDoubleAttribute(attributes,Xwait_squared),
 						XML::getLongAttribute(attributes,Xfaults) );
                 }
-                _stack.push( parse_stack_t(element,&Expat_Document::startNOP,nullptr) );
+                _stack.push( parse_stack_t(element,&Expat_Document::startMVAProfile,nullptr) );
 /* !!! SPEX document observations */
             } else {
                 XML::throw_element_error( element, attributes );
             }
         }
 
+
+        /*
+          <xsd:element name="mva-profile" minOccurs="0" maxOccurs="unbounded">
+        */
+
+        void
+        Expat_Document::startMVAProfile( DocumentObject * object, const XML_Char * element, const XML_Char ** attributes )
+        {
+            if ( strcasecmp( element, Xmva_profile ) == 0 ) {
+                if ( _loadResults ) {
+                    _document.addMVAProfile( XML::getStringAttribute(attributes,Xname),
+					     XML::getLongAttribute(attributes,Xcount),
+					     XML::getDoubleAttribute(attributes,Xtotal),
+					     XML::getDoubleAttribute(attributes,Xmean),
+					     XML::getDoubleAttribute(attributes,Xmax) );
+                }
+                _stack.push( parse_stack_t(element,&Expat_Document::startNOP,nullptr) );
+            } else {
+                XML::throw_element_error( element, attributes );
+            }
+        }
+
         /*
           <xsd:complexType name="ProcessorType">
           <xsd:annotation>
@@ -2392,16 +2414,29 @@ namespace LQIO {
 			output << XML::attribute( Xmax_rss, _document.getResultMaxRSS() );
 		    }
                     if ( has_mva_info ) {
+			const std::vector<MVAStatistics::Phase>& phases = mva_info.getPhases();
                         output << ">" << std::endl;
-                        output << XML::simple_element( Xmva_info )
+                        output << XML::start_element( Xmva_info, !phases.empty() )
                                << XML::attribute( Xsubmodels, mva_info.getNumberOfSubmodels() )
                                << XML::attribute( Xcore, static_cast<double>(mva_info.getNumberOfCore()) )
                                << XML::attribute( Xstep, mva_info.getNumberOfStep() )
                                << XML::attribute( Xstep_squared, mva_info.getNumberOfStepSquared() )
                                << XML::attribute( Xwait, mva_info.getNumberOfWait() )
                                << XML::attribute( Xwait_squared, mva_info.getNumberOfWaitSquared() )
-                               << XML::attribute( Xfaults, mva_info.getNumberOfFaults() )
-                               << "/>" << std::endl;
+                               << XML::attribute( Xfaults, mva_info.getNumberOfFaults() );
+			if ( !phases.empty() ) {
+			    output << ">" << std::endl;
+			    for ( std::vector<MVAStatistics::Phase>::const_iterator phase = phases.begin(); phase != phases.end(); ++phase ) {
+				output << XML::simple_element( Xmva_profile )
+				       << XML::attribute( Xname, phase->_name )
+				       << XML::attribute( Xcount, static_cast<long>(phase->_count) )
+				       << XML::attribute( Xtotal, phase->_total )
+				       << XML::attribute( Xmean, phase->_mean )
+				       << XML::attribute( Xmax, phase->_max )
+				       << "/>" << std::endl;
+			    }
+			}
+                        output << XML::end_element( Xmva_info, !phases.empty() ) << std::endl;
                     }
                     output << XML::end_element( Xresult_general, has_mva_info ) << std::endl;
                 }
@@ -3452,9 +3487,11 @@ namespace LQIO {
         const XML_Char * Expat_Document::Xmax =                                 "max";
 	const XML_Char * Expat_Document::Xmax_rss = 				"max-rss";
         const XML_Char * Expat_Document::Xmax_service_time =                    "max-service-time";
+        const XML_Char * Expat_Document::Xmean =                                "mean";
         const XML_Char * Expat_Document::Xmin =                                 "min";
         const XML_Char * Expat_Document::Xmultiplicity =                        "multiplicity";
         const XML_Char * Expat_Document::Xmva_info =                            "mva-info";
+        const XML_Char * Expat_Document::Xmva_profile =                         "mva-profile";
         const XML_Char * Expat_Document::Xname =                                "name";
         const XML_Char * Expat_Document::Xnumber_bins =                         "number-bins";
         const XML_Char * Expat_Document::Xopen_arrival_rate =                   "open-arrival-rate";
@@ -3546,6 +3583,7 @@ namespace LQIO {
         const XML_Char * Expat_Document::Xthink_time =                          "think-time";
         const XML_Char * Expat_Document::Xthroughput =                          "throughput";
         const XML_Char * Expat_Document::Xthroughput_bound =                    "throughput-bound";
+        const XML_Char * Expat_Document::Xtotal =                               "total";
         const XML_Char * Expat_Document::Xtype =                                "type";
         const XML_Char * Expat_Document::Xunderflow_bin =                       "underflow-bin";
         const XML_Char * Expat_Document::Xunderrelax_coeff =                    "underrelax_coeff";
@@ -9,6 +9,7 @@
 #ifndef __LQIO_DOM_DOCUMENT__
 #define __LQIO_DOM_DOCUMENT__
 
+#include <atomic>
 #include <map>
 #include <string>
 #include "dom_pragma.h"
@@ -26,6 +27,24 @@ namespace LQIO {
 
     extern struct lqio_params_stats
     {
+	/*
+	 * Errors are counted by thread, so models solved at the same time
+	 * on different threads do not see each other's errors.  A task run
+	 * for a model on another thread counts its errors into total, which
+	 * the thread that started it adds to its own count.
+	 */
+
+	class Count {
+	public:
+	    explicit Count( std::atomic<unsigned>& total ) : _total(total), _saved(error_count) {}
+	    ~Count() { _total += error_count - _saved; error_count = _saved; }
+	private:
+	    Count( const Count& ) = delete;
+	    Count& operator=( const Count& ) = delete;
+	    std::atomic<unsigned>& _total;
+	    const unsigned _saved;
+	};
+
 	lqio_params_stats( const char * version, void (*action)(error_severity) );
 	void reset() { error_count = 0; }
 	bool anError() const { return error_count > 0; }
@@ -38,7 +57,7 @@ namespace LQIO {
 	void (*severity_action)(LQIO::error_severity);	/* I:Severity action		  */
 
 	unsigned max_error;			/* I:Maximum error ID number	  */
-	mutable unsigned error_count;		/* IO:Number of errors		  */
+	static thread_local unsigned error_count;	/* IO:Number of errors		  */
 	LQIO::error_severity severity_level;	/* I:Messages < severity_level ignored. */
     } io_vars;
 
@@ -161,6 +180,8 @@ namespace LQIO {
 
 	    /* Results */
 	    Document& setMVAStatistics( const unsigned int, const unsigned long, const double, const double, const double, const double, const unsigned int );
+	    Document& addMVAProfile( const std::string& phase, const unsigned long count, const double total, const double mean, const double max ) { _mvaStatistics.addPhase( MVAStatistics::Phase( phase, count, total, mean, max ) ); return *this; }
+	    Document& clearMVAProfile() { _mvaStatistics.clearPhases(); return *this; }
 	    bool getResultValid() const { return _resultValid; }
 	    Document& setResultValid(bool resultValid);
 	    unsigned int getResultInvocationNumber() const { return _resultInvocationNumber; }
@@ -236,7 +257,23 @@ namespace LQIO {
 	    static void db_check_set_entry(DOM::Entry* entry, DOM::Entry::Type requisiteType = DOM::Entry::Type::NOT_DEFINED );
 	    ExternalVariable* db_build_parameter_variable(const std::string& input, bool* isSymbol);
 	    static void lqx_parser_trace( FILE * );
-	    static std::string __input_file_name;
+	    static thread_local std::string __input_file_name;
+
+	    /*
+	     * The input file is named by thread.  A task run for a model on
+	     * another thread names the file of the thread that started it
+	     * in its messages.
+	     */
+
+	    class InputFileName {
+	    public:
+		explicit InputFileName( const std::string& name ) : _saved(__input_file_name) { __input_file_name = name; }
+		~InputFileName() { __input_file_name = _saved; }
+	    private:
+		InputFileName( const InputFileName& ) = delete;
+		InputFileName& operator=( const InputFileName& ) = delete;
+		const std::string _saved;
+	    };
 
 	    static bool __debugXML;
 	    static bool __debugJSON;
@@ -329,7 +366,7 @@ namespace LQIO {
 	    static const std::map<const LQIO::DOM::Document::InputFormat,const LQIO::DOM::Document::OutputFormat> __input_to_output_format;
 	};
 
-	extern Document* __document;
+	extern thread_local Document* __document;	/* Document being loaded or solved by this thread. */
     }
 }
 #endif /* __LQIO_DOM_DOCUMENT__ */
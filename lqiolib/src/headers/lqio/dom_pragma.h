@@ -65,6 +65,7 @@ namespace LQIO {
 	    const static std::set<std::string> __quorum_delayed_calls_args;
 	    const static std::set<std::string> __quorum_distribution_args;
 	    const static std::set<std::string> __quorum_idle_time_args;
+	    const static std::set<std::string> __relaxation_args;
 	    const static std::set<std::string> __replication_args;
 	    const static std::set<std::string> __scheduling_model_args;
 	    const static std::set<std::string> __task_args;
@@ -77,8 +78,10 @@ namespace LQIO {
 	    static const char * _abort_all_;		// Quorum
 	    static const char * _abort_local_;		// Quorum
 	    static const char * _abort_remote_;		// Quorum
+	    static const char * _adaptive_;		// relaxation
 	    static const char * _advisory_;
 	    static const char * _all_;
+	    static const char * _anderson_;		// relaxation
 	    static const char * _batched_;
 	    static const char * _batched_back_;
 	    static const char * _bcmp_;			// BUG 270
@@ -87,6 +90,7 @@ namespace LQIO {
 	    static const char * _bruell_;		// multiserver
 	    static const char * _convergence_value_;
 	    static const char * _conway_;		// multiserver
+	    static const char * _conway_limit_;		// lqns
 	    static const char * _custom_;
 	    static const char * _custom_natural_;
 	    static const char * _cycles_;
@@ -102,6 +106,7 @@ namespace LQIO {
 	    static const char * _extended_;		// BUG 270
 	    static const char * _false_;
 	    static const char * _fast_;
+	    static const char * _fixed_;		// relaxation
 	    static const char * _fixed_rate_;
 	    static const char * _force_infinite_;
 	    static const char * _force_multiserver_;
@@ -116,6 +121,7 @@ namespace LQIO {
 	    static const char * _initial_loops_;
 	    static const char * _interlocking_;
 	    static const char * _iteration_limit_;
+	    static const char * _jacobi_;
 	    static const char * _join_delay_;		// Quorum
 	    static const char * _keep_all_;		// Quorum
 	    static const char * _layering_;
@@ -130,6 +136,8 @@ namespace LQIO {
 	    static const char * _multiserver_;
 	    static const char * _multiservers_;
 	    static const char * _mva_;
+	    static const char * _mva_anderson_;		// lqns, qnsolver
+	    static const char * _mva_threads_;		// lqns, qnsolver
 	    static const char * _nice_;
 	    static const char * _no_;
 	    static const char * _no_entry_;
@@ -150,6 +158,7 @@ namespace LQIO {
 	    static const char * _quorum_reply_;		// Quroum
 	    static const char * _reiser_;		// multiserver
 	    static const char * _reiser_ps_;		// multiserver
+	    static const char * _relaxation_;
 	    static const char * _replication_;
 	    static const char * _reschedule_on_async_send_;
 	    static const char * _rolia_;		// multiserver
@@ -162,6 +171,7 @@ namespace LQIO {
 	    static const char * _seed_value_;
 	    static const char * _severity_level_;
 	    static const char * _share_;
+	    static const char * _skip_converged_;
 	    static const char * _simple_;
 	    static const char * _special_;
 	    static const char * _spex_comment_;
@@ -169,6 +179,7 @@ namespace LQIO {
 	    static const char * _spex_header_;
 	    static const char * _spex_iteration_limit_;
 	    static const char * _spex_underrelaxation_;
+	    static const char * _split_submodels_;
 	    static const char * _squashed_;
 	    static const char * _srvn_;
 	    static const char * _stochastic_;
@@ -183,6 +194,7 @@ namespace LQIO {
 	    static const char * _true_;
 	    static const char * _underrelaxation_;
 	    static const char * _variance_;
+	    static const char * _warm_start_;
 	    static const char * _warning_;
 	    static const char * _yes_;
 	    static const char * _zhou_;			// Multiserver
@@ -248,6 +248,7 @@ namespace LQIO {
 	    void startModelType( DocumentObject *, const XML_Char * element, const XML_Char ** attributes );
 	    void startResultGeneral( DocumentObject *, const XML_Char * element, const XML_Char ** attributes );
 	    void startMVAInfo( DocumentObject *, const XML_Char * element, const XML_Char ** attributes );
+	    void startMVAProfile( DocumentObject *, const XML_Char * element, const XML_Char ** attributes );
 
 	    void startProcessorType( DocumentObject *, const XML_Char * element, const XML_Char ** attributes );
 	    void startGroupType( DocumentObject *, const XML_Char * element, const XML_Char ** attributes );
@@ -409,9 +410,11 @@ namespace LQIO {
 	    static const XML_Char *Xmax;
 	    static const XML_Char *Xmax_rss;
 	    static const XML_Char *Xmax_service_time;
+	    static const XML_Char *Xmean;
 	    static const XML_Char *Xmin;
 	    static const XML_Char *Xmultiplicity;
 	    static const XML_Char *Xmva_info;
+	    static const XML_Char *Xmva_profile;
 	    static const XML_Char *Xname;
 	    static const XML_Char *Xnumber_bins;
 	    static const XML_Char *Xopen_arrival_rate;
@@ -500,6 +503,7 @@ namespace LQIO {
 	    static const XML_Char *Xthink_time;
 	    static const XML_Char *Xthroughput;
 	    static const XML_Char *Xthroughput_bound;
+	    static const XML_Char *Xtotal;
 	    static const XML_Char *Xtype;
 	    static const XML_Char *Xunderrelax_coeff;
 	    static const XML_Char *Xuser_cpu_time;
@@ -993,6 +993,7 @@ namespace LQIO {
 	    static const char * Xconv_val_result;
 	    static const char * Xconvergence;
 	    static const char * Xcore;
+	    static const char * Xcount;
 	    static const char * Xdescription;
 	    static const char * Xdestination;
 	    static const char * Xdeterministic;
@@ -1024,6 +1025,7 @@ namespace LQIO {
 	    static const char * Xmin;
 	    static const char * Xmultiplicity;
 	    static const char * Xmva_info;
+	    static const char * Xmva_profile;
 	    static const char * Xname;
 	    static const char * Xnumber_bins;
 	    static const char * Xobserve;
@@ -324,34 +324,34 @@ namespace LQIO {
 	static std::vector<var_name_and_expr>::const_iterator find( std::vector<var_name_and_expr>::const_iterator, std::vector<var_name_and_expr>::const_iterator, const std::string& );
 
     public:
-	static std::set<std::string> __global_variables;			/* Document global variables. (input) */
+	static thread_local std::set<std::string> __global_variables;			/* Document global variables. (input) */
 
     private:
-	static std::vector<std::string> __scalar_variables;			/* Saves $<scalar_name> for output */
-	static std::vector<std::string> __array_variables;			/* Saves $<array_name> for generating nest for loops */
-	static std::set<std::string> __array_references;			/* Saves $<array_name> when used as an lvalue */
-	static std::vector<var_name_and_expr> __result_variables;		/* Saves $<name> for printing the header of variable names and the expression attached */
-	static std::vector<var_name_and_expr> __convergence_variables;		/* Saves $<name> for all variables used in convergence section */
-	static std::map<std::string,LQX::SyntaxTreeNode *> __observation_variables;	/* Saves all observations (name, and funky assignment) */
-	static std::map<std::string,ComprehensionInfo> __comprehensions;	/* Saves all comprehensions for $<name> */
-	static expr_list __deferred_assignment;					/* Saves all parameters that depend on a variable for latter assignment */
+	static thread_local std::vector<std::string> __scalar_variables;			/* Saves $<scalar_name> for output */
+	static thread_local std::vector<std::string> __array_variables;			/* Saves $<array_name> for generating nest for loops */
+	static thread_local std::set<std::string> __array_references;			/* Saves $<array_name> when used as an lvalue */
+	static thread_local std::vector<var_name_and_expr> __result_variables;		/* Saves $<name> for printing the header of variable names and the expression attached */
+	static thread_local std::vector<var_name_and_expr> __convergence_variables;		/* Saves $<name> for all variables used in convergence section */
+	static thread_local std::map<std::string,LQX::SyntaxTreeNode *> __observation_variables;	/* Saves all observations (name, and funky assignment) */
+	static thread_local std::map<std::string,ComprehensionInfo> __comprehensions;	/* Saves all comprehensions for $<name> */
+	static thread_local expr_list __deferred_assignment;					/* Saves all parameters that depend on a variable for latter assignment */
 
 	/* For SRVN input output */
 
-	static obs_var_tab_t __observations;					/* Saves all key-$var for each object */
-	static std::vector<ObservationInfo> __document_variables;		/* Saves all key-$var for the document */
-	static std::map<std::string,std::string> __input_iterator;		/* Saves iterator for x, y = expr statements */
-	static std::map<std::string,LQX::SyntaxTreeNode *> __input_variables;	/* Saves input values per iteration */
-	static std::map<const DOM::ExternalVariable *,const LQX::SyntaxTreeNode *> __inline_expression;	/* Maps temp vars to expressions */
+	static thread_local obs_var_tab_t __observations;					/* Saves all key-$var for each object */
+	static thread_local std::vector<ObservationInfo> __document_variables;		/* Saves all key-$var for the document */
+	static thread_local std::map<std::string,std::string> __input_iterator;		/* Saves iterator for x, y = expr statements */
+	static thread_local std::map<std::string,LQX::SyntaxTreeNode *> __input_variables;	/* Saves input values per iteration */
+	static thread_local std::map<const DOM::ExternalVariable *,const LQX::SyntaxTreeNode *> __inline_expression;	/* Maps temp vars to expressions */
 
 	static const std::map<const std::string,const attribute_table_t> __control_parameters;
 	static const std::map<const int,const std::pair<const std::string,const std::string> > __key_code_map;	/* Maps srvn_gram.h KEY_XXX to name */
 	static const std::map<const int,const std::string> __key_lqx_function_map;	/* Maps srvn_gram.h KEY_XXX to lqx function name */
 
-	static void * __parameter_list;						/* JSON */
-	static void * __result_list;						/* JSON */
-	static void * __convergence_list;					/* JSON */
-	static void * __temp_variable;						/* JSON */
+	static thread_local void * __parameter_list;						/* JSON */
+	static thread_local void * __result_list;						/* JSON */
+	static thread_local void * __convergence_list;					/* JSON */
+	static thread_local void * __temp_variable;						/* JSON */
 
 	expr_list _gnuplot;							/* Gnuplot program */
 	std::map<std::string,size_t> _result_pos;				/* Index of variable in list. */
@@ -359,7 +359,7 @@ namespace LQIO {
     };
 
     inline std::ostream& operator<<( std::ostream& output, const Spex::ComprehensionInfo& self) { return self.print( output ); }
-    extern class Spex spex;
+    extern thread_local class Spex spex;
 }
 #endif /* __cplusplus */
 #endif /* __LQIO_SRVN_SPEX_H__ */
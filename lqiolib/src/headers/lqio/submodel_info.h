@@ -9,11 +9,24 @@
 #ifndef __LQIO_DOM_MVA_STATISTICS__
 #define __LQIO_DOM_MVA_STATISTICS__
 
+#include <string>
+#include <vector>
+
 namespace LQIO {
     namespace DOM {
 
 	class MVAStatistics {
 	public:
+	    /* Wall clock time spent by the solver in one phase. */
+	    struct Phase {
+		Phase( const std::string& name, unsigned long count, double total, double mean, double max ) : _name(name), _count(count), _total(total), _mean(mean), _max(max) {}
+		std::string _name;
+		unsigned long _count;
+		double _total;
+		double _mean;
+		double _max;
+	    };
+
 	MVAStatistics() : _submodels(0), _core(0), _step(0.0), _step_squared(0.0), _wait(0.0), _wait_squared(0.0), _faults(0) {}
 
 	    void set( const unsigned int submodels,
@@ -39,6 +52,9 @@ namespace LQIO {
 	    double getNumberOfWait() const { return _wait; }
 	    double getNumberOfWaitSquared() const { return _wait_squared; }
 	    unsigned int getNumberOfFaults() const { return _faults; }
+	    const std::vector<Phase>& getPhases() const { return _phases; }
+	    void addPhase( const Phase& phase ) { _phases.push_back( phase ); }
+	    void clearPhases() { _phases.clear(); }
 	    
 	private:
 	    unsigned int _submodels;
@@ -48,6 +64,7 @@ namespace LQIO {
 	    double _wait;
 	    double _wait_squared;
 	    unsigned int _faults;
+	    std::vector<Phase> _phases;		/* Profile, if any.	*/
 	};
     }
 }
@@ -1406,6 +1406,27 @@ namespace LQIO {
 	    }
 	    catch ( const XML::missing_attribute& e ) {
 	    }
+
+	    /* Optional per-phase profile */
+
+	    const picojson::value::object::const_iterator profile = obj.find( Xmva_profile );
+	    if ( profile == obj.end() || !profile->second.is<picojson::array>() ) return;
+	    const picojson::value::array& phases = profile->second.get<picojson::array>();
+	    for ( picojson::value::array::const_iterator phase = phases.begin(); phase != phases.end(); ++phase ) {
+		if ( !phase->is<picojson::object>() ) {
+		    XML::invalid_argument( Xmva_profile, phase->to_str() );	/* throws... */
+		}
+		const picojson::value::object& attrs = phase->get<picojson::object>();
+		try {
+		    document->addMVAProfile( get_string_attribute( Xname, attrs ),
+					     get_long_attribute( Xcount, attrs ),
+					     get_double_attribute( Xtotal, attrs ),
+					     get_double_attribute( Xmean, attrs ),
+					     get_double_attribute( Xmax, attrs ) );
+		}
+		catch ( const XML::missing_attribute& e ) {
+		}
+	    }
 	}
 
 	const std::map<const char*,const JSON_Document::ImportObservation,JSON_Document::ImportObservation>  JSON_Document::observation_table =
@@ -2975,6 +2996,23 @@ namespace LQIO {
 			    << next_attribute( Xwait, mva_info.getNumberOfWait() )
 			    << next_attribute( Xwait_squared, mva_info.getNumberOfWaitSquared() )
 			    << next_attribute( Xfaults, static_cast<double>(mva_info.getNumberOfFaults() ) );
+		    const std::vector<MVAStatistics::Phase>& phases = mva_info.getPhases();
+		    if ( !phases.empty() ) {
+			_output << next_begin_array( Xmva_profile );
+			for ( std::vector<MVAStatistics::Phase>::const_iterator phase = phases.begin(); phase != phases.end(); ++phase ) {
+			    if ( phase != phases.begin() ) {
+				_output << ",";
+			    }
+			    _output << indent()
+				    << "{ \"" << Xname  << "\": \"" << phase->_name << "\""
+				    << ", \"" << Xcount << "\": " << phase->_count
+				    << ", \"" << Xtotal << "\": " << phase->_total
+				    << ", \"" << Xmean  << "\": " << phase->_mean
+				    << ", \"" << Xmax   << "\": " << phase->_max
+				    << " }";
+			}
+			_output << end_array();
+		    }
 		    _output << end_object();
 		}
 
@@ -4060,6 +4098,7 @@ namespace LQIO {
 	const char * JSON_Document::Xconv_val_result			= "convergence-value";
 	const char * JSON_Document::Xconvergence			= "convergence";
 	const char * JSON_Document::Xcore				= "core";
+	const char * JSON_Document::Xcount				= "count";
 	const char * JSON_Document::Xdescription			= "description";
 	const char * JSON_Document::Xdestination			= "destination";
 	const char * JSON_Document::Xdeterministic			= "determinstic-calls";
@@ -4091,6 +4130,7 @@ namespace LQIO {
 	const char * JSON_Document::Xmin				= "min";
 	const char * JSON_Document::Xmultiplicity			= "multiplicity";
 	const char * JSON_Document::Xmva_info				= "mva-info";
+	const char * JSON_Document::Xmva_profile			= "mva-profile";
 	const char * JSON_Document::Xname				= "name";
 	const char * JSON_Document::Xnumber_bins			= "bins";
 	const char * JSON_Document::Xobserve				= "observe";
@@ -1395,6 +1395,16 @@ namespace LQIO {
             if ( mva_info.getNumberOfFaults() ) {
                 _output << "    *** Faults *** " << mva_info.getNumberOfFaults() << newline;
             }
+	    if ( !mva_info.getPhases().empty() ) {
+		_output << newline << "    Phase           Count      Total       Mean        Max" << newline;
+		for ( std::vector<DOM::MVAStatistics::Phase>::const_iterator phase = mva_info.getPhases().begin(); phase != mva_info.getPhases().end(); ++phase ) {
+		    _output << "    " << std::setw(12) << std::left << phase->_name << std::right
+			    << std::setw(8) << phase->_count << " "
+			    << std::setw(10) << phase->_total << " "
+			    << std::setw(10) << phase->_mean << " "
+			    << std::setw(10) << phase->_max << newline;
+		}
+	    }
         }
     }
 
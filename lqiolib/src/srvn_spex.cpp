@@ -939,34 +939,34 @@ namespace LQIO {
 
     /* ------------------------------------------------------------------------ */
 
-    class Spex spex;
+    thread_local class Spex spex;
 
-    std::vector<std::string> Spex::__scalar_variables;				/* Saves $<scalar_name> for printing */
-    std::vector<std::string> Spex::__array_variables;				/* Saves $<array_name> for generating nest for loops */
-    std::set<std::string> Spex::__array_references;				/* Saves $<array_name> when used as an lvalue */
-    std::vector<Spex::var_name_and_expr> Spex::__result_variables;		/* Saves $<name> for printing the header of variable names */
-    std::vector<Spex::var_name_and_expr> Spex::__convergence_variables;		/* Saves $<name> for all variables used in convergence section */
-    std::map<std::string,LQX::SyntaxTreeNode *> Spex::__observation_variables;	/* Saves all observations (name, and funky assignment) */
-    std::map<std::string,Spex::ComprehensionInfo> Spex::__comprehensions;	/* Saves all comprehensions for $<name> */
-    expr_list Spex::__deferred_assignment;
+    thread_local std::vector<std::string> Spex::__scalar_variables;				/* Saves $<scalar_name> for printing */
+    thread_local std::vector<std::string> Spex::__array_variables;				/* Saves $<array_name> for generating nest for loops */
+    thread_local std::set<std::string> Spex::__array_references;				/* Saves $<array_name> when used as an lvalue */
+    thread_local std::vector<Spex::var_name_and_expr> Spex::__result_variables;		/* Saves $<name> for printing the header of variable names */
+    thread_local std::vector<Spex::var_name_and_expr> Spex::__convergence_variables;		/* Saves $<name> for all variables used in convergence section */
+    thread_local std::map<std::string,LQX::SyntaxTreeNode *> Spex::__observation_variables;	/* Saves all observations (name, and funky assignment) */
+    thread_local std::map<std::string,Spex::ComprehensionInfo> Spex::__comprehensions;	/* Saves all comprehensions for $<name> */
+    thread_local expr_list Spex::__deferred_assignment;
 
-    std::set<std::string> Spex::__global_variables;				/* Document global variables. (input) */
-    std::map<std::string,LQX::SyntaxTreeNode *> Spex::__input_variables;	/* Save for printing when __verbose == true */
-    Spex::obs_var_tab_t Spex::__observations;					/* Saves all key-$var for each object */
-    std::vector<Spex::ObservationInfo> Spex::__document_variables;		/* Saves all key-$var for the document */
-    std::map<std::string,std::string> Spex::__input_iterator;			/* Saves iterator for x, y = expr statements */
+    thread_local std::set<std::string> Spex::__global_variables;				/* Document global variables. (input) */
+    thread_local std::map<std::string,LQX::SyntaxTreeNode *> Spex::__input_variables;	/* Save for printing when __verbose == true */
+    thread_local Spex::obs_var_tab_t Spex::__observations;					/* Saves all key-$var for each object */
+    thread_local std::vector<Spex::ObservationInfo> Spex::__document_variables;		/* Saves all key-$var for the document */
+    thread_local std::map<std::string,std::string> Spex::__input_iterator;			/* Saves iterator for x, y = expr statements */
 
-    std::map<const DOM::ExternalVariable *,const LQX::SyntaxTreeNode *> Spex::__inline_expression;  /* Maps temp vars to expressions */
+    thread_local std::map<const DOM::ExternalVariable *,const LQX::SyntaxTreeNode *> Spex::__inline_expression;  /* Maps temp vars to expressions */
 
     bool Spex::__verbose = false;
     bool Spex::__no_header = false;
     bool Spex::__print_comment = false;
 
     /*+ JSON */
-    void * Spex::__parameter_list = nullptr;
-    void * Spex::__result_list = nullptr;
-    void * Spex::__convergence_list = nullptr;
-    void * Spex::__temp_variable = nullptr;
+    thread_local void * Spex::__parameter_list = nullptr;
+    thread_local void * Spex::__result_list = nullptr;
+    thread_local void * Spex::__convergence_list = nullptr;
+    thread_local void * Spex::__temp_variable = nullptr;
     /*- JSON */
 
     const std::map<const std::string,const Spex::attribute_table_t> Spex::__control_parameters =
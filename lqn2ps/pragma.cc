@@ -155,6 +155,7 @@ void Pragma::setLayering(const std::string& value)
 	{ LQIO::DOM::Pragma::_batched_,		Layering::BATCH },
 	{ LQIO::DOM::Pragma::_batched_back_,	Layering::BATCH },
 	{ LQIO::DOM::Pragma::_hwsw_,		Layering::HWSW },
+	{ LQIO::DOM::Pragma::_jacobi_,		Layering::BATCH },
 	{ LQIO::DOM::Pragma::_mol_,		Layering::MOL },
 	{ LQIO::DOM::Pragma::_mol_back_,	Layering::MOL },
 	{ LQIO::DOM::Pragma::_processor_,	Layering::PROCESSOR },
@@ -36,8 +36,8 @@
 
 /* ---------------------------------------------------------------------- */
 
-std::map<LQIO::DOM::ActivityList*, LQIO::DOM::ActivityList*> Activity::__actConnections;
-std::map<LQIO::DOM::ActivityList*, ActivityList *> Activity::__domToNative;
+thread_local std::map<LQIO::DOM::ActivityList*, LQIO::DOM::ActivityList*> Activity::__actConnections;
+thread_local std::map<LQIO::DOM::ActivityList*, ActivityList *> Activity::__domToNative;
 
 /* static */ void
 Activity::completeConnections()
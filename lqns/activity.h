@@ -355,8 +355,8 @@ public:
     static std::string fold( const std::string& s1, const Activity * a2 ) { return s1 + "," + a2->name(); }
 
 private:
-    static std::map<LQIO::DOM::ActivityList*, LQIO::DOM::ActivityList*> __actConnections;
-    static std::map<LQIO::DOM::ActivityList*, ActivityList *> __domToNative;
+    static thread_local std::map<LQIO::DOM::ActivityList*, LQIO::DOM::ActivityList*> __actConnections;
+    static thread_local std::map<LQIO::DOM::ActivityList*, ActivityList *> __domToNative;
 
 private:
     const Entity * _task;			/*				*/
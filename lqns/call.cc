@@ -501,11 +501,8 @@ Call::CV_sqr() const
 const Call&
 Call::followInterlock( Interlock::CollectTable& path ) const
 {
-    /* Mark current */
-
-    if ( rendezvous() > 0.0 && !path.prune() ) {
-	Interlock::CollectTable branch( path, path.calls() * rendezvous() );
-	const_cast<Entry *>(dstEntry())->initializeInterlock( branch );
+    if ( rendezvous() > 0.0 ) {
+	path.addArc( dstEntry(), rendezvous() );
     }
     return *this;
 }
@@ -42,7 +42,7 @@
 #include "task.h"
 #include "variance.h"
 
-unsigned Entry::max_phases	    = 0;
+thread_local unsigned Entry::max_phases	    = 0;
 
 /* ------------------------ Constructors etc. ------------------------- */
 
@@ -393,47 +393,31 @@ Entry::resetInterlock()
 
 
 /*
- * Follow and record a path of phase one calls.  If we are at the head
- * of a path, then all calls from the entry `current' regardless of
- * phase are used.  Otherwise, only phase 1 calls are used.
+ * Record the calls from this entry to every entry it reaches.  All
+ * calls from the entry at the head of a path are used, regardless of
+ * phase, then only phase 1 calls below it.  The reverse entry is
+ * the negative so that isInterlocked() works in both directions.
  */
 
 Entry&
-Entry::createInterlock()		/* Called from task -- initialized calls */
-{
-    Interlock::CollectTable calls;
-    initializeInterlock( calls );
-    return *this;
-}
-
-
-
-void
-Entry::initializeInterlock( Interlock::CollectTable& path )
-{
-    /*
-     * Check for cycles in graph.  Return if found.  Cycle catching
-     * is done by the other version.  Someday, we might make this more
-     * intelligent to compute the final prob. of following the arc.
-     */
-    if ( path.has_entry( this ) ) return;
-
-    path.push_back( this );
-
-    /* Update interlock table */
-
-    const Entry * rootEntry = path.front();
-
-    if ( rootEntry == this ) {
-	_interlock[rootEntry->entryId()] = path.calls();
-    } else {
-	const_cast<Entry *>(rootEntry)->_interlock[entryId()] += path.calls();
-	_interlock[rootEntry->entryId()] -= path.calls();
+Entry::createInterlock( Interlock::Flow& flow )		/* Called from task -- initialized calls */
+{
+    _interlock[entryId()] = InterlockInfo( 1.0, 1.0 );
+
+    const std::vector<Interlock::Arc>& arcs = flow.arcs( this );
+    flow.push( this );
+    for ( std::vector<Interlock::Arc>::const_iterator arc = arcs.begin(); arc != arcs.end(); ++arc ) {
+	if ( arc->_dst == this ) continue;
+	const std::map<const Entry *,double>& reach = flow.reach( arc->_dst );
+	for ( std::map<const Entry *,double>::const_iterator dst = reach.begin(); dst != reach.end(); ++dst ) {
+	    if ( dst->first == this ) continue;
+	    const InterlockInfo calls = arc->_calls * dst->second;
+	    _interlock[dst->first->entryId()] += calls;
+	    const_cast<Entry *>(dst->first)->_interlock[entryId()] -= calls;
+	}
     }
-
-    followInterlock( path );
-
-    path.pop_back();
+    flow.pop( this );
+    return *this;
 }
 
 
@@ -1159,6 +1143,7 @@ Entry::getInterlockedTasks( Interlock::CollectTasks& path ) const
      */
 
     const bool headOfPath = path.headOfPath();
+    if ( !headOfPath && path.found( this ) ) return *path.found( this );
     const unsigned int max_phase = headOfPath ? maxPhase() : 1;
 
     path.push_back( this );
@@ -1171,11 +1156,12 @@ Entry::getInterlockedTasks( Interlock::CollectTasks& path ) const
     }
     path.pop_back();
 
-    if ( found && !headOfPath ) {
+    if ( headOfPath ) return found;
+    if ( found ) {
 	path.insert( owner() );
     }
 
-    return found;
+    return path.setFound( this, found );
 }
 
 
@@ -1367,6 +1353,24 @@ TaskEntry::updateWait( const Submodel& submodel, const double relax )
 
     /* Scan calls to other task for matches with submodel. */
 
+    if ( !isActivityEntry() ) {
+	for ( auto& phase : _phase ) phase.updateWait( submodel, relax );
+    }
+
+    aggregateWait( n );
+    return *this;
+}
+
+
+
+/*
+ * Collect the waits of the activities (if any) into the phases, then
+ * total the phases for submodel n.
+ */
+
+Entry&
+Entry::aggregateWait( const unsigned n )
+{
     if ( isActivityEntry() ) {
 
 	for ( auto& phase : _phase ) phase.setWaitTime( n, 0.0 );
@@ -1390,16 +1394,45 @@ TaskEntry::updateWait( const Submodel& submodel, const double relax )
 	    }
 	    std::cout << std::endl;
 	}
+    }
 
-    } else {
+    _total.setWaitTime( n, std::accumulate( _phase.begin(), _phase.end(), 0.0, [=]( double l, const Phase& r ){ return l + r.getWaitTime( n ); } ) );
 
-	for ( auto& phase : _phase ) phase.updateWait( submodel, relax );
+    return *this;
+}
+
+
+
+/*
+ * Append the phase waits for the submodel to waits.  Activity entries
+ * have none of their own; their waits are those of the activities.
+ */
 
+std::vector<double>&
+Entry::getWaits( const Submodel& submodel, std::vector<double>& waits ) const
+{
+    if ( !isActivityEntry() ) {
+	const unsigned n = submodel.number();
+	for ( const auto& phase : _phase ) waits.push_back( phase.getWaitTime( n ) );
     }
+    return waits;
+}
 
-    _total.setWaitTime( n, std::accumulate( _phase.begin(), _phase.end(), 0.0, [=]( double l, const Phase& r ){ return l + r.getWaitTime( n ); } ) );
 
-    return *this;
+
+/*
+ * Set the phase waits for the submodel from waits (in the order of
+ * getWaits()), then recompute the total.
+ */
+
+Entry&
+Entry::setWaits( const Submodel& submodel, std::vector<double>::const_iterator& waits )
+{
+    const unsigned n = submodel.number();
+    if ( !isActivityEntry() ) {
+	for ( auto& phase : _phase ) phase.setWaitTime( n, *waits++ );
+    }
+    return aggregateWait( n );
 }
 
 
@@ -163,7 +163,7 @@ private:
 public:
     static bool joinsPresent;
     static bool deterministicPhases;
-    static unsigned max_phases;		/* maximum phase encountered.	*/
+    static thread_local unsigned max_phases;		/* maximum phase encountered.	*/
 	
     int operator==( const Entry& anEntry ) const;
     static void reset();
@@ -198,8 +198,7 @@ public:
     Entry& setSurrogateDelaySize( size_t );
 #endif
     Entry& resetInterlock();
-    Entry& createInterlock();
-    void initializeInterlock( Interlock::CollectTable& path );
+    Entry& createInterlock( Interlock::Flow& );
 
     /* Instance Variable access */
 
@@ -312,6 +311,8 @@ public:
 #if PAN_REPLICATION
     virtual double updateWaitReplication( const Submodel&, unsigned& ) = 0;
 #endif
+    std::vector<double>& getWaits( const Submodel&, std::vector<double>& ) const;
+    Entry& setWaits( const Submodel&, std::vector<double>::const_iterator& );
     Entry& saveClientResults( const MVASubmodel& submodel, const Server& station, unsigned int k );
     virtual Entry& saveOpenWait( const double aWait ) = 0;
     Entry& saveThroughput( double );
@@ -351,6 +352,7 @@ public:
 
 protected:
     Entry& setMaxPhase( const unsigned phase );
+    Entry& aggregateWait( const unsigned );
 
 private:
     void setThroughput( const double throughput ) { _throughput = throughput; }
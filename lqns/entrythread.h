@@ -39,6 +39,7 @@ public:
     /* Instance variable access */
 
     Thread& setSubmodelThinkTime( const double );
+    Thread& setThinkTime( const double think_time ) { _think_time = think_time; return *this; }
     Exponential startTime() const;
     Thread& startTime( const unsigned, const double );
     virtual double getStartTime() const { return _start_time.sum(); }
@@ -54,5 +54,6 @@ extern struct FLAGS {
 	
     unsigned long single_step;			/* Stop after each major iteration	*/
     unsigned int min_steps;			/* Minimum number of iterations.	*/
+    unsigned int parallel;			/* --parallel=n: SPEX sweep workers.	*/
 } flags;
 #endif
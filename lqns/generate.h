@@ -21,7 +21,7 @@ class MVASubmodel;
 #include <set>
 #include "pragma.h"
 #include <lqio/bcmp_document.h>
-template <typename Type> class Vector;
+#include <mva/vector.h>
 
 class Generate {
     enum class Multiserver { DEFAULT, CONWAY, REISER, REISER_PS, ROLIA, ROLIA_PS, ZHOU };
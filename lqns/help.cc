@@ -76,6 +76,10 @@ static const std::map<const std::string,const std::string> opt_help = {
     { "no-variance",				"Do not use variances in the waiting time calculations." },
     { "print-comment",				"Add the model comment as the first line of output when running with SPEX input." },
     { "print-interval",				"Output the intermediate solution of the model after <n> iterations." },
+    { "warm-start",				"Start each solution of a SPEX/LQX program from the converged waiting times of the previous one." },
+    { "jobs",					"Solve up to <n> of the input files at the same time.  Zero uses all of the processors." },
+    { "parallel",				"Solve the points of a SPEX sweep using <n> worker processes." },
+    { "profile",				"Output the wall clock time spent in each phase of each submodel as <csv> or <json>." },
     { "reset-mva",				"Reset the MVA calculation prior to solving a submodel." },
     { "trace-mva",				"Trace the operation of the MVA solver. <n> is a 64 bit number where the bit position is the submodel to trace." },
     { "debug-submodels",			"Print out submodels. <n> is a 64 bit number where the bit position is the submodel output." },
@@ -133,6 +137,10 @@ const std::map<const int,const Help::help_fptr> Help::__option_table =
 //  { 512+'v',  &Help::flagNoVariance },
     { 512+'c',	&Help::flagPrintComment },
     { 512+'p',	&Help::flagPrintInterval },
+    { 512+'w',	&Help::flagWarmStart },
+    { 512+'J',	&Help::flagJobs },
+    { 512+'P',	&Help::flagParallel },
+    { 512+'f',	&Help::flagProfile },
     { 512+'r',	&Help::flagReloadLQX },
     { 256+'S',  &Help::flagDebugSubmodels },
     { 256+'t',	&Help::flagTraceMVA },
@@ -147,6 +155,7 @@ const std::map<const int,const Help::help_fptr> Help::__option_table =
 const Help::pragma_map_t Help::__pragmas =
 {
     { LQIO::DOM::Pragma::_convergence_value_,       pragma_info( &Help::pragmaConvergenceValue ) },
+    { LQIO::DOM::Pragma::_conway_limit_,	    pragma_info( &Help::pragmaConwayLimit ) },
     { LQIO::DOM::Pragma::_cycles_,		    pragma_info( &Help::pragmaCycles, &__cycles_args ) },
     { LQIO::DOM::Pragma::_force_infinite_,	    pragma_info( &Help::pragmaForceInfinite, &__force_infinite_args ) },
     { LQIO::DOM::Pragma::_force_multiserver_,	    pragma_info( &Help::pragmaForceMultiserver, &__force_multiserver_args ) },
@@ -156,6 +165,8 @@ const Help::pragma_map_t Help::__pragmas =
     { LQIO::DOM::Pragma::_mol_underrelaxation_,     pragma_info( &Help::pragmaMOLUnderrelaxation ) },
     { LQIO::DOM::Pragma::_multiserver_,		    pragma_info( &Help::pragmaMultiserver, &__multiserver_args ) },
     { LQIO::DOM::Pragma::_mva_,			    pragma_info( &Help::pragmaMVA, &__mva_args ) },
+    { LQIO::DOM::Pragma::_mva_anderson_,	    pragma_info( &Help::pragmaMVAAnderson ) },
+    { LQIO::DOM::Pragma::_mva_threads_,		    pragma_info( &Help::pragmaMVAThreads ) },
     { LQIO::DOM::Pragma::_overtaking_,		    pragma_info( &Help::pragmaOvertaking, &__overtaking_args ) },
     { LQIO::DOM::Pragma::_processor_scheduling_,    pragma_info( &Help::pragmaProcessor, &__processor_args ) },
     { LQIO::DOM::Pragma::_prune_,		    pragma_info( &Help::pragmaPrune, &__prune_args ) },
@@ -164,21 +175,25 @@ const Help::pragma_map_t Help::__pragmas =
     { LQIO::DOM::Pragma::_quorum_distribution_,	    pragma_info( &Help::pragmaQuorumDistribution, &__quorum_distribution_args ) },
     { LQIO::DOM::Pragma::_quorum_idle_time_,	    pragma_info( &Help::pragmaIdleTime, &__idle_time_args ) },
 #endif
+    { LQIO::DOM::Pragma::_relaxation_,		    pragma_info( &Help::pragmaRelaxation, &__relaxation_args ) },
 #if RESCHEDULE
     { LQIO::DOM::Pragma::_reschedule_on_async_send_,pragma_info( &Help::pragmaReschedule, &__reschedule_args ) },
 #endif
     { LQIO::DOM::Pragma::_save_marginal_probabilities_,pragma_info( &Help::pragmaSaveMarginalProbabilities ) },
     { LQIO::DOM::Pragma::_severity_level_,	    pragma_info( &Help::pragmaSeverityLevel, &__warning_args ) },
+    { LQIO::DOM::Pragma::_skip_converged_,	    pragma_info( &Help::pragmaSkipConverged ) },
     { LQIO::DOM::Pragma::_spex_comment_,	    pragma_info( &Help::pragmaSpexComment, &__spex_comment_args ) },
     { LQIO::DOM::Pragma::_spex_convergence_,	    pragma_info( &Help::pragmaSpexConvergence ) },
     { LQIO::DOM::Pragma::_spex_iteration_limit_,    pragma_info( &Help::pragmaSpexIterationLimit ) },
     { LQIO::DOM::Pragma::_spex_underrelaxation_,    pragma_info( &Help::pragmaSpexUnderrelaxation ) },
     { LQIO::DOM::Pragma::_spex_header_,		    pragma_info( &Help::pragmaSpexHeader, &__spex_header_args ) },
+    { LQIO::DOM::Pragma::_split_submodels_,	    pragma_info( &Help::pragmaSplitSubmodels ) },
     { LQIO::DOM::Pragma::_stop_on_message_loss_,    pragma_info( &Help::pragmaStopOnMessageLoss, &__stop_on_message_loss_args ) },
     { LQIO::DOM::Pragma::_tau_,			    pragma_info( &Help::pragmaTau ) },
     { LQIO::DOM::Pragma::_threads_,		    pragma_info( &Help::pragmaThreads, &__threads_args ) },
     { LQIO::DOM::Pragma::_underrelaxation_,         pragma_info( &Help::pragmaUnderrelaxation ) },
     { LQIO::DOM::Pragma::_variance_,		    pragma_info( &Help::pragmaVariance, &__variance_args ) },
+    { LQIO::DOM::Pragma::_warm_start_,		    pragma_info( &Help::pragmaWarmStart, &__warm_start_args ) },
 };
 
 
@@ -215,6 +230,7 @@ const Help::parameter_map_t Help::__layering_args =
     { LQIO::DOM::Pragma::_batched_,	parameter_info(&Help::pragmaLayeringBatched,true) },
     { LQIO::DOM::Pragma::_batched_back_,parameter_info(&Help::pragmaLayeringBatchedBack) },
     { LQIO::DOM::Pragma::_hwsw_,	parameter_info(&Help::pragmaLayeringHwSw) },
+    { LQIO::DOM::Pragma::_jacobi_,	parameter_info(&Help::pragmaLayeringJacobi) },
     { LQIO::DOM::Pragma::_mol_,		parameter_info(&Help::pragmaLayeringMOL) },
     { LQIO::DOM::Pragma::_mol_back_,	parameter_info(&Help::pragmaLayeringMOLBack) },
     { LQIO::DOM::Pragma::_squashed_,	parameter_info(&Help::pragmaLayeringSquashed) },
@@ -252,6 +268,13 @@ const Help::parameter_map_t Help::__overtaking_args =
     { LQIO::DOM::Pragma::_special_,	parameter_info(&Help::pragmaOvertakingSpecial) }
 };
 
+const Help::parameter_map_t Help::__relaxation_args =
+{
+    { LQIO::DOM::Pragma::_adaptive_,	parameter_info(&Help::pragmaRelaxationAdaptive) },
+    { LQIO::DOM::Pragma::_anderson_,	parameter_info(&Help::pragmaRelaxationAnderson) },
+    { LQIO::DOM::Pragma::_fixed_,	parameter_info(&Help::pragmaRelaxationFixed,true) }
+};
+
 const Help::parameter_map_t Help::__processor_args =
 {
     { "fcfs",				parameter_info(&Help::pragmaProcessorFCFS) },
@@ -309,6 +332,11 @@ const Help::parameter_map_t Help::__variance_args = {
     { LQIO::DOM::Pragma::_stochastic_,	parameter_info(&Help::pragmaVarianceStochastic,true) }
 };
 
+const Help::parameter_map_t Help::__warm_start_args = {
+    { LQIO::DOM::Pragma::_false_,	parameter_info(&Help::pragmaWarmStartFalse,true) },
+    { LQIO::DOM::Pragma::_true_,	parameter_info(&Help::pragmaWarmStartTrue) }
+};
+
 const Help::parameter_map_t Help::__warning_args = {
     { LQIO::DOM::Pragma::_advisory_,	parameter_info(&Help::pragmaSeverityLevelRunTime) },
     { LQIO::DOM::Pragma::_all_,		parameter_info(&Help::pragmaSeverityLevelWarnings) },
@@ -937,6 +965,50 @@ Help::flagResetMVA( std::ostream& output, bool verbose ) const
 }
 
 
+std::ostream&
+Help::flagWarmStart( std::ostream& output, bool verbose ) const
+{
+    output << opt_help.at( "warm-start" ) << ix( *this, "warm start" ) << std::endl;
+    return output;
+}
+
+
+std::ostream&
+Help::flagJobs( std::ostream& output, bool verbose ) const
+{
+    output << opt_help.at( "jobs" ) << ix( *this, "jobs" ) << std::endl
+	   << "Each input file is solved on a thread of its own and its results are written to its own output file." << std::endl
+	   << "The pragmas " << emph( *this, LQIO::DOM::Pragma::_mva_threads_ ) << ", " << emph( *this, LQIO::DOM::Pragma::_conway_limit_ ) << ", " << emph( *this, LQIO::DOM::Pragma::_tau_ )
+	   << " and the other settings shared by the solvers are taken from the command line; a warning is given if an input file sets them." << std::endl;
+    return output;
+}
+
+
+std::ostream&
+Help::flagParallel( std::ostream& output, bool verbose ) const
+{
+    output << opt_help.at( "parallel" ) << ix( *this, "parallel" ) << std::endl
+	   << "The output is merged back in the order of the sweep." << std::endl
+	   << "Every point of a sweep is solved from reset MVA solvers whether or not this option is given, so the results are those of a sequential run." << std::endl
+	   << "Warnings are printed by the parent once the workers have finished." << std::endl
+	   << "If a worker cannot evaluate the results of the points it skips, the sweep is solved again sequentially." << std::endl
+	   << "Sweeps with convergence variables, and runs with " << emph( *this, "warm-start" ) << ", are solved sequentially." << std::endl;
+    return output;
+}
+
+
+std::ostream&
+Help::flagProfile( std::ostream& output, bool verbose ) const
+{
+    output << opt_help.at( "profile" ) << ix( *this, "profile" ) << std::endl
+	   << "The phases are building the submodels, setting up interlocking, solving the closed and open models," << std::endl
+	   << "saving the results and updating the waiting times.  The count, total, mean and maximum are written" << std::endl
+	   << "to a file with the extension " << emph( *this, "profile.csv" ) << " or " << emph( *this, "profile.json" ) << " next to the output file." << std::endl
+	   << "The totals by phase are also added to the solver information of the results." << std::endl;
+    return output;
+}
+
+
 std::ostream&
 Help::flagRestartLQX( std::ostream& output, bool verbose ) const
 {
@@ -1244,7 +1316,8 @@ Help::traceMVA( std::ostream & output, bool verbose ) const
 {
     output << "Output the inputs and results of each MVA submodel for every iteration of the solver." << ix( *this, "MVA!trace" ) << std::endl;
     if ( verbose ) {
-	output << "The optional argument is a bit set of the submodels to output.  Submodel 1 is 0x1, " << std::endl
+	output << "The results include the use of the population tables of Conway multiservers." << std::endl
+	       << "The optional argument is a bit set of the submodels to output.  Submodel 1 is 0x1, " << std::endl
 	       << "submodel 2 is 0x2, submodel 3 is 0x4, etc.  By default all submodels are traced." << std::endl;
     }
     return output;
@@ -1412,6 +1485,19 @@ Help::pragmaConvergenceValue( std::ostream & output, bool verbose ) const
 
 /* -- */
 
+std::ostream&
+Help::pragmaConwayLimit( std::ostream & output, bool verbose ) const
+{
+    output << "Use the Rolia multiserver approximation" << ix( *this, "multiserver!Conway" ) << " for a Conway multiserver when there are more than " << emph( *this, "arg" ) << " populations to sum over." << std::endl;
+    if ( verbose ) {
+	output << emph( *this, "Arg" ) << " must be an integer.  The number of populations grows exponentially with the number of chains." << std::endl
+	       << "The default value is 0 (no limit)." << std::endl;
+    }
+    return output;
+}
+
+/* -- */
+
 std::ostream&
 Help::pragmaCycles( std::ostream& output, bool verbose ) const
 {
@@ -1590,6 +1676,14 @@ Help::pragmaLayeringHwSw( std::ostream& output, bool verbose ) const
     return output;
 }
 
+std::ostream&
+Help::pragmaLayeringJacobi( std::ostream& output, bool verbose ) const
+{
+    output << "Jacobi layering" << ix( *this, "Jacobi layers" ) << ix( *this, "layering!Jacobi" ) << " -- batched layers, but every layer is solved using the results of the previous iteration." << std::endl
+	   << "The layers are solved at the same time with one thread per processor, whatever the value of " << emph( *this, LQIO::DOM::Pragma::_mva_threads_ ) << "." << std::endl;
+    return output;
+}
+
 std::ostream&
 Help::pragmaLayeringMOL( std::ostream& output, bool verbose ) const
 {
@@ -1761,6 +1855,33 @@ Help::pragmaMVAOneStepLinearizer( std::ostream& output, bool verbose ) const
 
 /* -- */
 
+std::ostream&
+Help::pragmaMVAAnderson( std::ostream& output, bool verbose ) const
+{
+    output << "Use Anderson acceleration" << ix( *this, "MVA!Anderson acceleration" ) << " of depth " << emph( *this, "arg" ) << " for the fixed point iteration of the approximate MVA solvers." << std::endl;
+    if ( verbose ) {
+	output << emph( *this, "Arg" ) << " must be an integer.  Four is usually sufficient." << std::endl
+	       << "The default value is 0 (successive substitution)." << std::endl;
+    }
+    return output;
+}
+
+/* -- */
+
+std::ostream&
+Help::pragmaMVAThreads( std::ostream& output, bool verbose ) const
+{
+    output << "Use " << emph( *this, "arg" ) << " threads" << ix( *this, "MVA!threads" ) << " to solve the reduced populations of Linearizer, the populations of each level of Exact MVA, and the disjoint groups of split submodels." << std::endl;
+    if ( verbose ) {
+	output << emph( *this, "Arg" ) << " must be an integer.  Zero uses all of the processors." << std::endl
+	       << "The default value is 1 (no threads)." << std::endl
+	       << emph( *this, LQIO::DOM::Pragma::_jacobi_ ) << " layering always solves its layers with one thread per processor." << std::endl;
+    }
+    return output;
+}
+
+/* -- */
+
 std::ostream&
 Help::pragmaOvertaking( std::ostream& output, bool verbose ) const
 {
@@ -1806,6 +1927,37 @@ Help::pragmaOvertakingNone( std::ostream& output, bool verbose ) const
 
 /* -- */
 
+std::ostream&
+Help::pragmaRelaxation( std::ostream& output, bool verbose ) const
+{
+    output << "This pragma is used to choose how the waiting times are relaxed" << ix( *this, "underrelaxation" ) << " between iterations of the layers." << std::endl
+	   << emph( *this, "Arg" ) << " must be one of: " << std::endl;
+    return output;
+}
+
+std::ostream&
+Help::pragmaRelaxationAdaptive( std::ostream& output, bool verbose ) const
+{
+    output << "Halve the underrelaxation when the convergence value grows from one iteration to the next, and raise it back towards the value set for the model when it shrinks." << std::endl;
+    return output;
+}
+
+std::ostream&
+Help::pragmaRelaxationAnderson( std::ostream& output, bool verbose ) const
+{
+    output << "Mix the waiting times of each submodel with those of the last few iterations using Anderson acceleration" << ix( *this, "Anderson acceleration" ) << "." << std::endl;
+    return output;
+}
+
+std::ostream&
+Help::pragmaRelaxationFixed( std::ostream& output, bool verbose ) const
+{
+    output << "Use the underrelaxation set for the model for every iteration." << std::endl;
+    return output;
+}
+
+/* -- */
+
 std::ostream&
 Help::pragmaProcessor( std::ostream& output, bool verbose ) const
 {
@@ -1911,6 +2063,18 @@ Help::pragmaSaveMarginalProbabilities( std::ostream& output, bool verbose ) cons
     return output;
 }
 
+std::ostream&
+Help::pragmaSkipConverged( std::ostream& output, bool verbose ) const
+{
+    output << "Do not solve a submodel" << ix( *this, "submodel!skip" ) << " when its service times, visits and think times have not changed at all since it was last solved." << std::endl
+	   << "Every submodel is solved on every " << emph( *this, "arg" ) << "th iteration." << std::endl;
+    if ( verbose ) {
+	output << emph( *this, "Arg" ) << " must be an integer." << std::endl
+	       << "The default value is 0 (solve every submodel on every iteration)." << std::endl;
+    }
+    return output;
+}
+
 std::ostream&
 Help::pragmaSeverityLevel( std::ostream& output, bool verbose ) const
 {
@@ -1993,6 +2157,17 @@ Help::pragmaSpexUnderrelaxation( std::ostream& output, bool verbose ) const
     return output;
 }
 
+std::ostream&
+Help::pragmaSplitSubmodels( std::ostream& output, bool verbose ) const
+{
+    output << "This pragma is used to enable or disable solving the disjoint groups of clients and servers of a submodel" << ix( *this, "submodel!split" ) << " with separate MVA solvers." << std::endl;
+    if ( verbose ) {
+	output << "The groups are solved in parallel when " << emph( *this, LQIO::DOM::Pragma::_mva_threads_ ) << " is greater than one." << std::endl
+	       << "The default is false." << std::endl;
+    }
+    return output;
+}
+
 /* -- */
 
 std::ostream&
@@ -2164,6 +2339,30 @@ Help::pragmaVarianceInitOnly( std::ostream& output, bool verbose ) const
 
 /* -- */
 
+std::ostream&
+Help::pragmaWarmStart( std::ostream& output, bool verbose ) const
+{
+    output << "This pragma is used to choose the starting point for each solution of a SPEX or LQX program." << ix( *this, "warm start" ) << std::endl
+	   << emph( *this, "Arg" ) << " must be one of: " << std::endl;
+    return output;
+}
+
+std::ostream&
+Help::pragmaWarmStartFalse( std::ostream& output, bool verbose ) const
+{
+    output << "Start each solution from the initial waiting times." << std::endl;
+    return output;
+}
+
+std::ostream&
+Help::pragmaWarmStartTrue( std::ostream& output, bool verbose ) const
+{
+    output << "Start each solution from the waiting times of the last one, if it converged." << std::endl;
+    return output;
+}
+
+/* -- */
+
 #if HAVE_LIBGSL && HAVE_LIBGSLCBLAS
 std::ostream&
 Help::pragmaQuorumDelayedCalls( std::ostream& output, bool verbose ) const
@@ -165,6 +165,10 @@ private:
     std::ostream& flagRTF( std::ostream& output, bool verbose ) const;
     std::ostream& flagReloadLQX( std::ostream& output, bool verbose ) const;
     std::ostream& flagResetMVA( std::ostream& output, bool verbose ) const;
+    std::ostream& flagWarmStart( std::ostream& output, bool verbose ) const;
+    std::ostream& flagJobs( std::ostream& output, bool verbose ) const;
+    std::ostream& flagParallel( std::ostream& output, bool verbose ) const;
+    std::ostream& flagProfile( std::ostream& output, bool verbose ) const;
     std::ostream& flagRestartLQX( std::ostream& output, bool verbose ) const;
     std::ostream& flagSRVNLayering( std::ostream& output, bool verbose ) const;
     std::ostream& flagSchweitzerMVA( std::ostream& output, bool verbose ) const;
@@ -228,6 +232,7 @@ public:
     std::ostream& speicalSkipLayer( std::ostream & output, bool verbose ) const;
 
     std::ostream& pragmaConvergenceValue( std::ostream & output, bool verbose ) const;
+    std::ostream& pragmaConwayLimit( std::ostream & output, bool verbose ) const;
     std::ostream& pragmaCycles( std::ostream& output, bool verbose ) const;
     std::ostream& pragmaForceInfinite( std::ostream& output, bool verbose ) const;
     std::ostream& pragmaForceMultiserver( std::ostream& output, bool verbose ) const;
@@ -236,10 +241,13 @@ public:
     std::ostream& pragmaLayering( std::ostream& output, bool verbose ) const;
     std::ostream& pragmaMOLUnderrelaxation( std::ostream & output, bool verbose ) const;
     std::ostream& pragmaMVA( std::ostream& output, bool verbose ) const;
+    std::ostream& pragmaMVAAnderson( std::ostream& output, bool verbose ) const;
+    std::ostream& pragmaMVAThreads( std::ostream& output, bool verbose ) const;
     std::ostream& pragmaMultiserver( std::ostream& output, bool verbose ) const;
     std::ostream& pragmaOvertaking( std::ostream& output, bool verbose ) const;
     std::ostream& pragmaProcessor( std::ostream& output, bool verbose ) const;
     std::ostream& pragmaPrune( std::ostream& output, bool verbose ) const;
+    std::ostream& pragmaRelaxation( std::ostream& output, bool verbose ) const;
     std::ostream& pragmaStopOnMessageLoss( std::ostream& output, bool verbose ) const;
 #if HAVE_LIBGSL && HAVE_LIBGSLCBLAS
     std::ostream& pragmaQuorumDistribution( std::ostream& output, bool verbose ) const;
@@ -252,16 +260,19 @@ public:
     std::ostream& pragmaRescheduleFalse( std::ostream& output, bool verbose ) const;
 #endif
     std::ostream& pragmaSaveMarginalProbabilities( std::ostream& output, bool verbose ) const;
+    std::ostream& pragmaSkipConverged( std::ostream& output, bool verbose ) const;
     std::ostream& pragmaSeverityLevel( std::ostream& output, bool verbose ) const;
     std::ostream& pragmaSpexComment( std::ostream& output, bool verbose ) const;
     std::ostream& pragmaSpexConvergence( std::ostream& output, bool verbose ) const;
     std::ostream& pragmaSpexHeader( std::ostream& output, bool verbose ) const;
     std::ostream& pragmaSpexIterationLimit( std::ostream& output, bool verbose ) const;
     std::ostream& pragmaSpexUnderrelaxation( std::ostream& output, bool verbose ) const;
+    std::ostream& pragmaSplitSubmodels( std::ostream& output, bool verbose ) const;
     std::ostream& pragmaTau( std::ostream& output, bool verbose ) const;
     std::ostream& pragmaThreads( std::ostream& output, bool verbose ) const;
     std::ostream& pragmaUnderrelaxation( std::ostream & output, bool verbose ) const;
     std::ostream& pragmaVariance( std::ostream& output, bool verbose ) const;
+    std::ostream& pragmaWarmStart( std::ostream& output, bool verbose ) const;
 
     std::ostream& pragmaCyclesAllow( std::ostream& output, bool verbose ) const;
     std::ostream& pragmaCyclesDisallow( std::ostream& output, bool verbose ) const;
@@ -285,6 +296,7 @@ public:
     std::ostream& pragmaLayeringBatched( std::ostream& output, bool verbose ) const;
     std::ostream& pragmaLayeringBatchedBack( std::ostream& output, bool verbose ) const;
     std::ostream& pragmaLayeringHwSw( std::ostream& output, bool verbose ) const;
+    std::ostream& pragmaLayeringJacobi( std::ostream& output, bool verbose ) const;
     std::ostream& pragmaLayeringMOL( std::ostream& output, bool verbose ) const;
     std::ostream& pragmaLayeringMOLBack( std::ostream& output, bool verbose ) const;
     std::ostream& pragmaLayeringSquashed( std::ostream& output, bool verbose ) const;
@@ -313,6 +325,10 @@ public:
     std::ostream& pragmaOvertakingSpecial( std::ostream& output, bool verbose ) const;
     std::ostream& pragmaOvertakingNone( std::ostream& output, bool verbose ) const;
 
+    std::ostream& pragmaRelaxationAdaptive( std::ostream& output, bool verbose ) const;
+    std::ostream& pragmaRelaxationAnderson( std::ostream& output, bool verbose ) const;
+    std::ostream& pragmaRelaxationFixed( std::ostream& output, bool verbose ) const;
+
     std::ostream& pragmaProcessorDefault( std::ostream& output, bool verbose ) const;
     std::ostream& pragmaProcessorFCFS( std::ostream& output, bool verbose ) const;
     std::ostream& pragmaProcessorHOL( std::ostream& output, bool verbose ) const;
@@ -341,6 +357,9 @@ public:
     std::ostream& pragmaSpexHeaderFalse( std::ostream& output, bool verbose ) const;
     std::ostream& pragmaSpexHeaderTrue( std::ostream& output, bool verbose ) const;
 
+    std::ostream& pragmaWarmStartFalse( std::ostream& output, bool verbose ) const;
+    std::ostream& pragmaWarmStartTrue( std::ostream& output, bool verbose ) const;
+
     std::ostream& pragmaPruneFalse( std::ostream& output, bool verbose ) const;
     std::ostream& pragmaPruneTrue( std::ostream& output, bool verbose ) const;
 
@@ -374,6 +393,7 @@ private:
     static const parameter_map_t  __multiserver_args;
     static const parameter_map_t  __mva_args;
     static const parameter_map_t  __overtaking_args;
+    static const parameter_map_t  __relaxation_args;
     static const parameter_map_t  __processor_args;
     static const parameter_map_t  __prune_args;
 #if RESCHEDULE
@@ -384,6 +404,7 @@ private:
     static const parameter_map_t  __stop_on_message_loss_args;
     static const parameter_map_t  __threads_args;
     static const parameter_map_t  __variance_args;
+    static const parameter_map_t  __warm_start_args;
     static const parameter_map_t  __warning_args;
 #if HAVE_LIBGSL && HAVE_LIBGSLCBLAS
     static const parameter_map_t  __quorum_distribution_args;
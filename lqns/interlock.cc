@@ -25,7 +25,6 @@
 #define DEBUG_INTERLOCK 1
 
 bool Interlock::CollectTasks::has_entry(const Entry * entry ) const { return std::find( _entryStack.begin(), _entryStack.end(), entry ) != _entryStack.end(); }
-bool Interlock::CollectTable::has_entry(const Entry * entry ) const { return std::find( _entryStack.begin(), _entryStack.end(), entry ) != _entryStack.end(); }
 
 /* -------------------------------------------------------------------- */
 /* Funky Formatting functions for inline with <<.			*/
@@ -138,6 +137,90 @@ bool CallInfo::Item::collect_calls::compare::operator()( CallInfo::Item& item )
     return item.dstEntry() == _dstEntry;
 }
 
+/*----------------------------------------------------------------------*/
+/*                          Interlock Path Table                        */
+/*----------------------------------------------------------------------*/
+
+/*
+ * Record a rendezvous from the entry being collected.  Phase 2+ flow
+ * does not count towards phase 1.
+ */
+
+void
+Interlock::CollectTable::addArc( const Entry * dst, double rendezvous )
+{
+    InterlockInfo calls = _calls * rendezvous;
+    if ( _phase2 ) calls.ph1 = 0.0;
+    _arcs.emplace_back( dst, calls, _phase2 );
+}
+
+
+
+/*
+ * Return the rendezvous made by entry through all of its phases or
+ * activities.  The arcs are collected once per table.
+ */
+
+const std::vector<Interlock::Arc>&
+Interlock::Flow::arcs( const Entry * entry )
+{
+    std::map<const Entry *,std::vector<Arc>>::iterator item = _arcs.find( entry );
+    if ( item == _arcs.end() ) {
+	item = _arcs.emplace( entry, std::vector<Arc>() ).first;
+	CollectTable path( entry, item->second );
+	entry->followInterlock( path );
+    }
+    return item->second;
+}
+
+
+
+/*
+ * Return the calls from entry to all the entries it reaches through
+ * phase one rendezvous, including entry itself with a rate of one.
+ * The flow from entry is the sum of the flows of the entries it calls,
+ * so each entry is visited once rather than once per path.  A call
+ * cycle is cut at the first entry found again on the path, as the path
+ * table always did, so a flow below a cut depends on the path and is
+ * found again for each one.  It is returned from _cut, so the caller
+ * must use it before calling reach() again.  A kept flow never reaches
+ * an entry on the path, otherwise it would have cut a cycle.
+ */
+
+const std::map<const Entry *,double>&
+Interlock::Flow::reach( const Entry * entry )
+{
+    std::map<const Entry *,std::map<const Entry *,double>>::const_iterator item = _reach.find( entry );
+    if ( item != _reach.end() ) {
+	_cycle = false;
+	return item->second;
+    }
+
+    bool cycle = false;
+    std::map<const Entry *,double> flow;
+    flow[entry] = 1.0;
+    _visiting.insert( entry );
+    for ( std::vector<Arc>::const_iterator arc = arcs( entry ).begin(); arc != arcs( entry ).end(); ++arc ) {
+	if ( arc->_phase2 ) continue;
+	if ( _visiting.find( arc->_dst ) != _visiting.end() ) {
+	    cycle = true;					/* Cycles are caught elsewhere */
+	    continue;
+	}
+	const std::map<const Entry *,double>& next = reach( arc->_dst );
+	cycle = cycle || _cycle;
+	for ( std::map<const Entry *,double>::const_iterator dst = next.begin(); dst != next.end(); ++dst ) {
+	    flow[dst->first] += arc->_calls.all * dst->second;
+	}
+    }
+    _visiting.erase( entry );
+    _cycle = cycle;
+    if ( cycle ) {
+	_cut = std::move( flow );
+	return _cut;
+    }
+    return _reach.emplace( entry, std::move( flow ) ).first->second;
+}
+
 /************************************************************************/
 /*                     Throughput Interlock Model.                      */
 /************************************************************************/
@@ -153,7 +236,8 @@ Interlock::Interlock( const Entity& aServer )
       _allSourceTasks(),
       _ph2SourceTasks(),
       _server(aServer), 
-      _sources(0)
+      _sources(0),
+      _callees()
 {
 }
 
@@ -192,30 +276,69 @@ Interlock::findInterlock()
     std::set<Task *> clients;
     _server.getClients( clients );
 
-    for ( std::set<Task *>::const_iterator clientA = clients.begin(); clientA != clients.end(); ++clientA ) {
-	if ( !(*clientA)->isUsed() ) continue;		/* Ignore this task - not used. */
+    /* Find the entries of each client that call me, once. */
 
-	for ( std::set<Task *>::const_iterator clientC = clients.begin(); clientC != clients.end(); ++clientC ) {
-	    if ( (*clientA) == (*clientC) || !(*clientC)->isUsed() ) continue;
+    std::map<const Task *,std::vector<const Entry *>> callers;
+    for ( std::set<Task *>::const_iterator client = clients.begin(); client != clients.end(); ++client ) {
+	if ( !(*client)->isUsed() ) continue;		/* Ignore this task - not used. */
+	std::vector<const Entry *>& entries = callers[*client];
+	for ( std::vector<Entry *>::const_iterator entry = (*client)->entries().begin(); entry != (*client)->entries().end(); ++entry ) {
+	    if ( std::any_of( _server.entries().begin(), _server.entries().end(), [=]( const Entry * dst ){ return (*entry)->isInterlocked( dst ); } ) ) {
+		entries.push_back( *entry );
+	    }
+	}
+    }
 
-	    for ( std::vector<Entry *>::const_iterator entryA = (*clientA)->entries().begin(); entryA != (*clientA)->entries().end(); ++entryA ) {
-		for ( std::vector<Entry *>::const_iterator entryC = (*clientC)->entries().begin(); entryC != (*clientC)->entries().end(); ++entryC ) {
-		    bool foundAB = false;
-		    bool foundCD = false;
+    /* ... and the entries that reach each of them, also once. */
 
-		    /* Check that both entries call me. */
+    std::map<const Entry *,Parents> parents;
+    for ( std::map<const Task *,std::vector<const Entry *>>::const_iterator client = callers.begin(); client != callers.end(); ++client ) {
+	for ( std::vector<const Entry *>::const_iterator entry = client->second.begin(); entry != client->second.end(); ++entry ) {
+	    parents.emplace( *entry, findParents( *(*entry) ) );
+	}
+    }
 
-		    for ( std::vector<Entry *>::const_iterator entry = _server.entries().begin(); entry != _server.entries().end(); ++entry ) {
-			if ( (*entryA)->isInterlocked( (*entry) ) ) foundAB = true;
-			if ( (*entryC)->isInterlocked( (*entry) ) ) foundCD = true;
-		    }
-		    if ( foundAB && foundCD ) {
-			findParentEntries( *(*entryA), *(*entryC) );
-		    }
+    for ( std::map<const Task *,std::vector<const Entry *>>::const_iterator clientA = callers.begin(); clientA != callers.end(); ++clientA ) {
+	for ( std::map<const Task *,std::vector<const Entry *>>::const_iterator clientC = callers.begin(); clientC != callers.end(); ++clientC ) {
+	    if ( clientA == clientC ) continue;
+
+	    for ( std::vector<const Entry *>::const_iterator entryA = clientA->second.begin(); entryA != clientA->second.end(); ++entryA ) {
+		for ( std::vector<const Entry *>::const_iterator entryC = clientC->second.begin(); entryC != clientC->second.end(); ++entryC ) {
+		    findParentEntries( *(*entryA), parents.at( *entryA ), *(*entryC), parents.at( *entryC ) );
 		}
 	    }
 	}
     }
+    _callees.clear();
+}
+
+
+
+/*
+ * Return the entries of each task that reach entry, grouped by the
+ * position of the task in Model::__task.  Only these entries can be
+ * common parents of entry and another, so findParentEntries() pairs
+ * them instead of every pair of entries of every task.
+ */
+
+Interlock::Parents
+Interlock::findParents( const Entry& entry )
+{
+    const unsigned a = entry.entryId();
+    Parents parents;
+    unsigned i = 0;
+    for ( std::set<Task *>::const_iterator task = Model::__task.begin(); task != Model::__task.end(); ++task, ++i ) {
+	std::vector<const Entry *> entries;
+	for ( std::vector<Entry *>::const_iterator src = (*task)->entries().begin(); src != (*task)->entries().end(); ++src ) {
+	    if ( (*src)->_interlock[a].all > 0.0 ) {
+		entries.push_back( *src );
+	    }
+	}
+	if ( !entries.empty() ) {
+	    parents.emplace_back( i, std::move( entries ) );
+	}
+    }
+    return parents;
 }
 
 
@@ -226,44 +349,48 @@ Interlock::findInterlock()
  */
 
 void
-Interlock::findParentEntries( const Entry& srcA, const Entry& srcC )
+Interlock::findParentEntries( const Entry& entryA, const Parents& parentsA, const Entry& entryC, const Parents& parentsC )
 {
-    const Entry& entryA = srcA;
-    const Entry& entryC = srcC;
-    const unsigned a = entryA.entryId();
-    const unsigned c = entryC.entryId();
-
     if ( Options::Debug::interlock() ) {
-	std::cout << "    Common parents for entries " << srcA.name() << " and " << srcC.name() << ": ";
+	std::cout << "    Common parents for entries " << entryA.name() << " and " << entryC.name() << ": ";
     }
 
     /* Figure 6 in interlock paper. */
 
-    for ( std::set<Task *>::const_iterator aTask = Model::__task.begin(); aTask != Model::__task.end(); ++aTask ) {
+    Parents::const_iterator aTask = parentsA.begin();
+    Parents::const_iterator cTask = parentsC.begin();
+    while ( aTask != parentsA.end() && cTask != parentsC.end() ) {
+	if ( aTask->first < cTask->first ) {
+	    ++aTask;
+	    continue;
+	} else if ( cTask->first < aTask->first ) {
+	    ++cTask;
+	    continue;
+	}
 
 	/* x calls a, a calls b; y calls c, c calls d */
 
-	for ( std::vector<Entry *>::const_iterator srcX = (*aTask)->entries().begin(); srcX != (*aTask)->entries().end(); ++srcX ) {
-	    for ( std::vector<Entry *>::const_iterator srcY = (*aTask)->entries().begin(); srcY != (*aTask)->entries().end(); ++srcY ) {
-		if ( (*srcX)->_interlock[a].all > 0.0 && (*srcY)->_interlock[c].all > 0.0 ) {
+	for ( std::vector<const Entry *>::const_iterator srcX = aTask->second.begin(); srcX != aTask->second.end(); ++srcX ) {
+	    for ( std::vector<const Entry *>::const_iterator srcY = cTask->second.begin(); srcY != cTask->second.end(); ++srcY ) {
 
-		    /* Prune here (branch point?) */
+		/* Prune here (branch point?) */
 
-		    if ( Options::Debug::interlock() ) {
-			std::cout << (*srcX)->name();
-		    }
+		if ( Options::Debug::interlock() ) {
+		    std::cout << (*srcX)->name();
+		}
 
-		    if ( isBranchPoint( *(*srcX), entryA, *(*srcY), entryC ) ) {
-			_commonEntries.insert(*srcX);
-			if ( Options::Debug::interlock() ) {
-			    std::cout << "* ";
-			}
-		    } else if ( Options::Debug::interlock() ) {
-			std::cout << " ";
+		if ( isBranchPoint( *(*srcX), entryA, *(*srcY), entryC ) ) {
+		    _commonEntries.insert(*srcX);
+		    if ( Options::Debug::interlock() ) {
+			std::cout << "* ";
 		    }
+		} else if ( Options::Debug::interlock() ) {
+		    std::cout << " ";
 		}
 	    }
 	}
+	++aTask;
+	++cTask;
     }
 
     if ( Options::Debug::interlock() ) {
@@ -352,6 +479,7 @@ void
 Interlock::findSources()
 {
     std::set<const Entity *> interlockedTasks;
+    CollectTasks data( _server, interlockedTasks );
 
     /* Look for all parent tasks */
 
@@ -368,7 +496,6 @@ Interlock::findSources()
 
 	/* Locate all tasks on interlocked paths. */
 
-	CollectTasks data( _server, interlockedTasks );
 	(*entry)->getInterlockedTasks( data );
     }
 
@@ -419,7 +546,7 @@ Interlock::findSources()
  */
 
 bool
-Interlock::isBranchPoint( const Entry& srcX, const Entry& entryA, const Entry& srcY, const Entry& entryB ) const
+Interlock::isBranchPoint( const Entry& srcX, const Entry& entryA, const Entry& srcY, const Entry& entryB )
 {
     /*
      * I have to ensure that a call to myself (which is not feasible...)
@@ -450,21 +577,17 @@ Interlock::isBranchPoint( const Entry& srcX, const Entry& entryA, const Entry& s
      * go to a and b respectively
      */
 
-    CallInfo nextX( srcX, LQIO::DOM::Call::Type::RENDEZVOUS );
-    CallInfo nextY( srcY, LQIO::DOM::Call::Type::RENDEZVOUS );
+    const std::vector<const Entry *>& nextX = callees( srcX );
+    const std::vector<const Entry *>& nextY = callees( srcY );
 
     const unsigned a = entryA.entryId();
     const unsigned b = entryB.entryId();
 
-    for ( std::vector<CallInfo::Item>::const_iterator yxe = nextX.begin(); yxe != nextX.end(); ++yxe ) {
-	const Entry * dstE = yxe->dstEntry();
-
-	if ( dstE->_interlock[a].all == 0.0 ) continue;
+    for ( std::vector<const Entry *>::const_iterator dstE = nextX.begin(); dstE != nextX.end(); ++dstE ) {
+	if ( (*dstE)->_interlock[a].all == 0.0 ) continue;
 
-	for ( std::vector<CallInfo::Item>::const_iterator yyf = nextY.begin(); yyf != nextY.end(); ++yyf ) {
-	    const Entry * dstF = yyf->dstEntry();
-
-	    if ( dstF->_interlock[b].all > 0.0 && dstE->owner() != dstF->owner() ) return true;
+	for ( std::vector<const Entry *>::const_iterator dstF = nextY.begin(); dstF != nextY.end(); ++dstF ) {
+	    if ( (*dstF)->_interlock[b].all > 0.0 && (*dstE)->owner() != (*dstF)->owner() ) return true;
 	}
     }
 
@@ -473,6 +596,28 @@ Interlock::isBranchPoint( const Entry& srcX, const Entry& entryA, const Entry& s
 
 
 
+/*
+ * Return the entries that entry calls by rendezvous.  They are found
+ * once for each entry while looking for branch points as the calls are
+ * collected through all of the phases or activities of the entry.
+ */
+
+const std::vector<const Entry *>&
+Interlock::callees( const Entry& entry )
+{
+    std::map<const Entry *,std::vector<const Entry *>>::iterator item = _callees.find( &entry );
+    if ( item == _callees.end() ) {
+	item = _callees.emplace( &entry, std::vector<const Entry *>() ).first;
+	const CallInfo calls( entry, LQIO::DOM::Call::Type::RENDEZVOUS );
+	for ( std::vector<CallInfo::Item>::const_iterator call = calls.begin(); call != calls.end(); ++call ) {
+	    item->second.push_back( call->dstEntry() );
+	}
+    }
+    return item->second;
+}
+
+
+
 /*
  * This procedure is used to locate all of the other sources that are along the
  * call paths.  Tasks found cannot be in sources or in paths.
@@ -18,6 +18,7 @@
 #define	LQNS_INTERLOCK_H
 
 #include <deque>
+#include <map>
 #include <set>
 #include <vector>
 #include <lqio/dom_call.h>
@@ -123,7 +124,8 @@ public:
 	CollectTasks( const Entity& server, std::set<const Entity *>& interlockedTasks )
 	    : _server(server),
 	      _entryStack(),
-	      _interlockedTasks( interlockedTasks )
+	      _interlockedTasks( interlockedTasks ),
+	      _found()
 	    {}
 
     private:
@@ -140,18 +142,36 @@ public:
 	const Entry * back() const { return _entryStack.back(); }
 	std::pair<std::set<const Entity *>::const_iterator,bool> insert( const Entity * entity ) { return _interlockedTasks.insert( entity ); }
 	bool has_entry( const Entry * entry ) const;
+
+	/* Below the head of the path, the outcome depends only on the entry, so it is searched once. */
+	const bool * found( const Entry * entry ) const { std::map<const Entry *,bool>::const_iterator i = _found.find( entry ); return i != _found.end() ? &i->second : nullptr; }
+	bool setFound( const Entry * entry, bool found ) { _found[entry] = found; return found; }
 	
     private:
 	const Entity& _server;				/* In */
 	std::deque<const Entry *> _entryStack;		/* local */
 	std::set<const Entity *>& _interlockedTasks;	/* Out */
+	std::map<const Entry *,bool> _found;		/* local */
+    };
+
+    /*
+     * A rendezvous from an entry to dst, with the calls through the
+     * entry's phases or activities folded in.  Phase 2 arcs are only
+     * followed from the head of a path.
+     */
+
+    struct Arc {
+	Arc( const Entry * dst, const InterlockInfo& calls, bool phase2 ) : _dst(dst), _calls(calls), _phase2(phase2) {}
+	const Entry * _dst;
+	InterlockInfo _calls;
+	bool _phase2;
     };
 
     class CollectTable {
     public:
-	CollectTable() : _entryStack(), _phase2(false), _calls(1.0,1.0) {}
-	CollectTable( const CollectTable& src, bool phase2 ) : _entryStack(src._entryStack), _phase2(phase2), _calls(src._calls) {}
-	CollectTable( const CollectTable& src, const InterlockInfo& calls ) : _entryStack(src._entryStack), _phase2(src._phase2), _calls(calls)
+	CollectTable( const Entry * entry, std::vector<Arc>& arcs ) : _entry(entry), _phase2(false), _calls(1.0,1.0), _arcs(arcs) {}
+	CollectTable( const CollectTable& src, bool phase2 ) : _entry(src._entry), _phase2(phase2), _calls(src._calls), _arcs(src._arcs) {}
+	CollectTable( const CollectTable& src, const InterlockInfo& calls ) : _entry(src._entry), _phase2(src._phase2), _calls(calls), _arcs(src._arcs)
 	    {
 		if ( _phase2 ) _calls.ph1 = 0.0;
 	    }
@@ -161,20 +181,46 @@ public:
 	CollectTable& operator=( const CollectTable& ) = delete;
 
     public:
-	bool prune() const { return _entryStack.size() > 1 && _phase2; }
 	InterlockInfo& calls() { return _calls; }
 	const InterlockInfo& calls() const { return _calls; }
-	
-	void push_back( const Entry * entry ) { _entryStack.push_back( entry ); }
-	void pop_back() { _entryStack.pop_back(); }
-	const Entry * front() const { return _entryStack.front(); }
-	const Entry * back() const { return _entryStack.back(); }
-	bool has_entry( const Entry * entry ) const;
+	const Entry * back() const { return _entry; }
+	void addArc( const Entry * dst, double rendezvous );
 
     private:
-	std::deque<const Entry *> _entryStack;		/* local */
+	const Entry * _entry;				/* local */
 	bool _phase2;					/* local */
-	InterlockInfo _calls;				/* out */
+	InterlockInfo _calls;				/* local */
+	std::vector<Arc>& _arcs;			/* out */
+    };
+
+    /*
+     * The flow of calls from an entry to every entry it reaches by
+     * phase one rendezvous, found once per entry and reused by every
+     * path through it.  This replaces following each call path from
+     * the head.  A flow that cuts a call cycle (allowed by pragma)
+     * depends on the path taken to it, so it is not kept.
+     */
+
+    class Flow {
+    public:
+	Flow() : _arcs(), _reach(), _visiting(), _cycle(false), _cut() {}
+
+    private:
+	Flow( const Flow& ) = delete;
+	Flow& operator=( const Flow& ) = delete;
+
+    public:
+	const std::vector<Arc>& arcs( const Entry * );
+	const std::map<const Entry *,double>& reach( const Entry * );
+	void push( const Entry * entry ) { _visiting.insert( entry ); }
+	void pop( const Entry * entry ) { _visiting.erase( entry ); }
+
+    private:
+	std::map<const Entry *,std::vector<Arc>> _arcs;
+	std::map<const Entry *,std::map<const Entry *,double>> _reach;
+	std::set<const Entry *> _visiting;		/* Cycle guard */
+	bool _cycle;					/* Last reach() cut a cycle */
+	std::map<const Entry *,double> _cut;		/* Last flow that was not kept */
     };
 
 public:
@@ -194,12 +240,16 @@ private:
     Interlock& operator=( const Interlock& );
 
 private:
+    typedef std::vector<std::pair<unsigned,std::vector<const Entry *>>> Parents;	/* Task index, entries */
+
     void findInterlock();
     void pruneInterlock();
     void findSources();
-    void findParentEntries( const Entry&, const Entry& );
+    static Parents findParents( const Entry& );
+    void findParentEntries( const Entry&, const Parents&, const Entry&, const Parents& );
 
-    bool isBranchPoint( const Entry& srcX, const Entry& entryA, const Entry& srcY, const Entry& entryB ) const;
+    bool isBranchPoint( const Entry& srcX, const Entry& entryA, const Entry& srcY, const Entry& entryB );
+    const std::vector<const Entry *>& callees( const Entry& );
     bool getInterlockedTasks( const int headOfPath, const Entry *, std::set<const Entity *>& interlockedTasks ) const; 
     unsigned countSources( const std::set<const Entity *>& );
 
@@ -209,6 +259,7 @@ private:
     std::set<const Entity *> _ph2SourceTasks;	/* Phase 2+ sources.		*/
     const Entity& _server;			/* My server.			*/
     unsigned _sources;
+    std::map<const Entry *,std::vector<const Entry *>> _callees;	/* findInterlock() only	*/
 };
 
 inline std::ostream& operator<<( std::ostream& output, const Interlock& self) { return self.print( output ); }
@@ -100,6 +100,10 @@ const struct option longopts[] =
     { LQIO::DOM::Pragma::_spex_convergence_,	required_argument, nullptr, 256+'C' },
     { "print-comment",				no_argument,	   nullptr, 512+'c' },
     { "print-interval",				optional_argument, nullptr, 512+'p' },
+    { "warm-start",				no_argument,	   nullptr, 512+'w' },
+    { "jobs",					required_argument, nullptr, 512+'J' },
+    { "parallel",				required_argument, nullptr, 512+'P' },
+    { "profile",				optional_argument, nullptr, 512+'f' },
     { "reset-mva",				no_argument,	   nullptr, 256+'r' },
     { "trace-mva",				optional_argument, nullptr, 256+'t' },
     { "debug-submodels",			no_argument,	   nullptr, 256+'S' },
@@ -128,6 +132,7 @@ extern "C" int getsubopt (char **, char * const *, char **);
 int main (int argc, char *argv[])
 {
     std::string outputFileName = "";
+    unsigned jobs = 1;
     LQIO::DOM::Document::OutputFormat output_format = LQIO::DOM::Document::OutputFormat::DEFAULT;
     LQIO::CommandLine command_line( longopts );
     Options::Debug::initialize();
@@ -331,6 +336,40 @@ int main (int argc, char *argv[])
 		Options::Special::print_interval( optarg != nullptr ? optarg : std::string("") );
 		break;
 
+	    case 512+'w':
+		pragmas.insert(LQIO::DOM::Pragma::_warm_start_,"true");
+		break;
+
+	    case 512+'J': {
+		char * endptr = nullptr;
+		const long value = strtol( optarg, &endptr, 10 );
+		if ( *endptr != '\0' || value < 0 ) {
+		    std::cerr << LQIO::io_vars.lq_toolname << ": Invalid number of jobs: " << optarg << std::endl;
+		    exit( INVALID_ARGUMENT );
+		}
+		jobs = value;
+		break;
+	    }
+
+	    case 512+'P': {
+		char * endptr = nullptr;
+		const long value = strtol( optarg, &endptr, 10 );
+		if ( *endptr != '\0' || value < 1 ) {
+		    std::cerr << LQIO::io_vars.lq_toolname << ": Invalid number of workers: " << optarg << std::endl;
+		    exit( INVALID_ARGUMENT );
+		}
+		flags.parallel = value;
+		break;
+	    }
+
+	    case 512+'f':
+		SolverReport::__profile = optarg != nullptr ? optarg : "csv";
+		if ( SolverReport::__profile != "csv" && SolverReport::__profile != "json" ) {
+		    std::cerr << LQIO::io_vars.lq_toolname << ": Invalid profile format: " << optarg << std::endl;
+		    exit( INVALID_ARGUMENT );
+		}
+		break;
+
 	    case 256+'q': //tomari quorum options
 		flags.disable_expanding_quorum_tree = true;
 		break;
@@ -477,11 +516,15 @@ int main (int argc, char *argv[])
             }
         }
 
-        for ( ; optind < argc; ++optind ) {
-            if ( file_count > 1 ) {
-                std::cout << argv[optind] << ':' << std::endl;
+        if ( jobs != 1 && file_count > 1 ) {
+            global_error_flag = Model::solve( solve_function, std::vector<std::string>( &argv[optind], &argv[argc] ), outputFileName, output_format, jobs );
+        } else {
+            for ( ; optind < argc; ++optind ) {
+                if ( file_count > 1 ) {
+                    std::cout << argv[optind] << ':' << std::endl;
+                }
+                global_error_flag |= Model::solve( solve_function, argv[optind], outputFileName, output_format );
             }
-            global_error_flag |= Model::solve( solve_function, argv[optind], outputFileName, output_format );
         }
     }
 
@@ -524,6 +567,8 @@ void init_flags()
     flags.min_steps             = 2;            /* Default of 2 steps. */
 #endif
 
+    flags.parallel		= 1;
+
     flags.ignore_overhanging_threads = false;
     flags.full_reinitialize          = false;               /* Maybe a pragma?                      */
 }
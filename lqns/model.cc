@@ -39,6 +39,8 @@
 #include <fstream>
 #include <functional>
 #include <iostream>
+#include <mutex>
+#include <thread>
 #if HAVE_UNISTD_H
 #include <unistd.h>
 #endif
@@ -50,9 +52,11 @@
 #include <lqio/srvn_output.h>
 #include <lqio/srvn_spex.h>
 #include <mva/fpgoop.h>
+#include <mva/multserv.h>
 #include <mva/mva.h>
 #include <mva/open.h>
 #include <mva/server.h>
+#include <mva/threadpool.h>
 #include "activity.h"
 #include "actlist.h"
 #include "call.h"
@@ -75,15 +79,17 @@
 #include "variance.h"
 
 unsigned int Model::__print_interval = 0;
-Processor * Model::__think_server = nullptr;
-unsigned Model::__sync_submodel = 0;
+bool Model::__batch = false;
+std::mutex Model::__output_mutex;
+thread_local Processor * Model::__think_server = nullptr;
+thread_local unsigned Model::__sync_submodel = 0;
 
 LQIO::DOM::Document::InputFormat Model::__input_format = LQIO::DOM::Document::InputFormat::AUTOMATIC;
 
-std::set<Processor *,Model::lt_replica<Processor>> Model::__processor;
-std::set<Group *,Model::lt_replica<Group>> Model::__group;
-std::set<Task *,Model::lt_replica<Task>> Model::__task;
-std::set<Entry *,Model::lt_replica<Entry>> Model::__entry;
+thread_local std::set<Processor *,Model::lt_replica<Processor>> Model::__processor;
+thread_local std::set<Group *,Model::lt_replica<Group>> Model::__group;
+thread_local std::set<Task *,Model::lt_replica<Task>> Model::__task;
+thread_local std::set<Entry *,Model::lt_replica<Entry>> Model::__entry;
 
 /*----------------------------------------------------------------------*/
 /*                           Factory Methods                            */
@@ -103,14 +109,30 @@ Model::solve( solve_using solve_function, const std::string& inputFileName, cons
 
     if ( document == nullptr  ) {
 	return INVALID_INPUT;
-    } else if ( LQIO::io_vars.anError() ) {
-	delete document;
-	return INVALID_INPUT;
+    }
+
+    const int status = LQIO::io_vars.anError() ? INVALID_INPUT : solve( solve_function, document, inputFileName, outputFileName, outputFormat );
+    delete document;
+    return status;
+}
+
+
+
+/*
+ * Solve a document which has been loaded, and print.  The document
+ * is not deleted.
+ */
+
+int
+Model::solve( solve_using solve_function, LQIO::DOM::Document * document, const std::string& inputFileName, const std::string& outputFileName, LQIO::DOM::Document::OutputFormat outputFormat )
+{
+    LQIO::DOM::__document = document;		/* It may have been loaded by another thread */
+    if ( __batch ) {
+	warnLibraryParameters( document, inputFileName );
     }
 
     document->mergePragmas( pragmas.getList() );	/* Save pragmas -- prepare will process */
     if ( Model::prepare(document) == false ) {
-	delete document;
 	return INVALID_INPUT;
     }
 
@@ -198,8 +220,10 @@ Model::solve( solve_using solve_function, const std::string& inputFileName, cons
 	}
 
 	if ( status == 0 ) {
-	    /* Invoke the LQX program itself */
-	    if ( !program->invoke() ) {
+	    /* Invoke the LQX program itself.  SPEX sweeps can be shared by worker processes. */
+	    const bool parallel = flags.parallel > 1 && !__batch && !Pragma::warmStart()
+		&& !LQIO::Spex::input_variables().empty() && LQIO::Spex::convergence_variables().empty();
+	    if ( !(parallel ? SolverInterface::Solve::invokeInParallel( program, output, flags.parallel ) : program->invoke()) ) {
 		LQIO::runtime_error( LQIO::ERR_LQX_EXECUTION, inputFileName.c_str() );
 		status = INVALID_INPUT;
 	    } else if ( !SolverInterface::Solve::solveCallViaLQX ) {
@@ -212,11 +236,13 @@ Model::solve( solve_using solve_function, const std::string& inputFileName, cons
 
 	if ( output ) fclose( output );
 	delete program;
+	if ( Pragma::warmStart() ) {
+	    model->printStarts( std::cerr );
+	}
     }
 
     /* Clean things up */
     if ( model ) delete model;
-    delete document;
 
     return status;
 }
@@ -224,6 +250,141 @@ Model::solve( solve_using solve_function, const std::string& inputFileName, cons
 
 
 
+/*
+ * Solve a batch of input files, up to jobs at a time, each on a
+ * thread of its own.  Each file is loaded by the thread which solves
+ * it, so SPEX input is handled.
+ */
+
+int
+Model::solve( solve_using solve_function, const std::vector<std::string>& inputFileNames, const std::string& outputFileName, LQIO::DOM::Document::OutputFormat outputFormat, unsigned jobs )
+{
+    if ( jobs == 0 ) {
+	jobs = ThreadPool::hardware_concurrency();
+    }
+    jobs = std::min( jobs, static_cast<unsigned>(inputFileNames.size()) );
+
+    int status = 0;
+    if ( jobs <= 1 ) {
+	for ( std::vector<std::string>::const_iterator inputFileName = inputFileNames.begin(); inputFileName != inputFileNames.end(); ++inputFileName ) {
+	    if ( inputFileNames.size() > 1 ) {
+		std::cout << *inputFileName << ':' << std::endl;
+	    }
+	    status |= solve( solve_function, *inputFileName, outputFileName, outputFormat );
+	}
+	return status;
+    }
+
+    return solveBatch( inputFileNames.size(), jobs, [&]( const size_t i ) {
+	    {
+		std::lock_guard<std::mutex> lock( __output_mutex );
+		std::cout << inputFileNames[i] << ':' << std::endl;
+	    }
+	    return solve( solve_function, inputFileNames[i], outputFileName, outputFormat );
+	} );
+}
+
+
+
+/*
+ * Solve a batch of documents which have been loaded, up to jobs at a
+ * time.  inputFileNames[i] is the name used for the output of
+ * documents[i].  The state of a SPEX sweep is kept by the thread which
+ * loaded it, so documents with SPEX must be solved on that thread,
+ * either one at a time or with the version above.  The documents are
+ * not deleted.
+ */
+
+int
+Model::solve( solve_using solve_function, const std::vector<LQIO::DOM::Document *>& documents, const std::vector<std::string>& inputFileNames, const std::string& outputFileName, LQIO::DOM::Document::OutputFormat outputFormat, unsigned jobs )
+{
+    assert( documents.size() == inputFileNames.size() );
+    if ( jobs == 0 ) {
+	jobs = ThreadPool::hardware_concurrency();
+    }
+    jobs = std::min( jobs, static_cast<unsigned>(documents.size()) );
+
+    return solveBatch( documents.size(), std::max( jobs, 1U ), [&]( const size_t i ) {
+	    LQIO::io_vars.reset();
+	    Entry::reset();
+	    return solve( solve_function, documents[i], inputFileNames[i], outputFileName, outputFormat );
+	} );
+}
+
+
+
+/*
+ * Run solve(i) for i = 0..n-1 on jobs threads.  The model being solved
+ * (the tasks, processors, entries and pragmas, the DOM and the error
+ * count) is kept per thread, so the solutions do not interfere.  The
+ * settings that the libraries keep for the whole process are taken
+ * from the command line pragmas, not from the documents.
+ */
+
+int
+Model::solveBatch( const size_t n, const unsigned jobs, const std::function<int(const size_t)>& solve )
+{
+    Pragma::set( pragmas.getList() );
+    setLibraryParameters();
+    __batch = true;
+
+    int status = 0;
+    std::mutex mutex;
+    size_t next = 0;
+    std::vector<std::thread> threads;
+    for ( unsigned j = 0; j < jobs; ++j ) {
+	threads.emplace_back( [&]() {
+		for ( ;; ) {
+		    size_t i;
+		    {
+			std::lock_guard<std::mutex> lock( mutex );
+			if ( next == n ) break;
+			i = next++;
+		    }
+		    const int rc = solve( i );
+		    std::lock_guard<std::mutex> lock( mutex );
+		    status |= rc;
+		}
+		Pragma::clear();		/* The cache is per thread */
+	    } );
+    }
+    std::for_each( threads.begin(), threads.end(), std::mem_fn( &std::thread::join ) );
+
+    __batch = false;
+    return status;
+}
+
+
+
+/*
+ * The settings of the libraries are shared by every model of a batch,
+ * so those set by the document alone are ignored.  Say so.
+ */
+
+void
+Model::warnLibraryParameters( const LQIO::DOM::Document * document, const std::string& inputFileName )
+{
+    static const std::vector<const char *> __library_pragmas = {
+	LQIO::DOM::Pragma::_conway_limit_,
+	LQIO::DOM::Pragma::_mol_underrelaxation_,
+	LQIO::DOM::Pragma::_mva_anderson_,
+	LQIO::DOM::Pragma::_mva_threads_,
+	LQIO::DOM::Pragma::_severity_level_,
+	LQIO::DOM::Pragma::_spex_comment_,
+	LQIO::DOM::Pragma::_spex_header_,
+	LQIO::DOM::Pragma::_tau_
+    };
+
+    for ( std::vector<const char *>::const_iterator name = __library_pragmas.begin(); name != __library_pragmas.end(); ++name ) {
+	if ( document->hasPragma( *name ) && !pragmas.have( *name ) ) {
+	    std::lock_guard<std::mutex> lock( __output_mutex );
+	    std::cerr << LQIO::io_vars.lq_toolname << ": pragma " << *name << " is ignored for " << inputFileName << " when solving with --jobs." << std::endl;
+	}
+    }
+}
+
+
+
 /*
  * Step 1: load model.
  */
@@ -242,6 +403,10 @@ Model::load( const std::string& input_filename, const std::string& output_filena
 	set_fp_abort();
     }
 
+    /* The parsers are not reentrant, so load one document at a time. */
+    static std::mutex mutex;
+    std::lock_guard<std::mutex> lock( mutex );
+
     LQIO::io_vars.reset();
     Entry::reset();
 
@@ -268,10 +433,9 @@ Model::prepare(const LQIO::DOM::Document* document)
 
     /* Update the pragma list from the document (merge), then set globals here as this has to be done prior to runlqx() */
     Pragma::set( document->getPragmaList() );
-    LQIO::io_vars.severity_level = Pragma::severityLevel();
-    LQIO::Spex::__no_header = !Pragma::spexHeader();
-    LQIO::Spex::__print_comment = Pragma::spexComment();
-    MVA::MOL_multiserver_underrelaxation = Pragma::molUnderrelaxation();
+    if ( !__batch ) {
+	setLibraryParameters();
+    }
 
     /* -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=- [Step 1: Add Processors] */
 
@@ -370,6 +534,26 @@ Model::prepare(const LQIO::DOM::Document* document)
 
 
 
+/*
+ * Set the options held by the libraries for the whole process from
+ * the pragmas.
+ */
+
+void
+Model::setLibraryParameters()
+{
+    LQIO::io_vars.severity_level = Pragma::severityLevel();
+    LQIO::Spex::__no_header = !Pragma::spexHeader();
+    LQIO::Spex::__print_comment = Pragma::spexComment();
+    MVA::MOL_multiserver_underrelaxation = Pragma::molUnderrelaxation();
+    MVA::__threads = Pragma::mvaThreads();
+    MVA::__anderson = Pragma::mvaAnderson();
+    MVA::__bounds_limit = Pragma::tau();
+    Conway_Multi_Server::__max_populations = Pragma::conwayLimit();
+}
+
+
+
 /*
  * Dynamic Updates / Late Finalization
  * In order to integrate LQX's support for model changes we need to
@@ -402,11 +586,11 @@ Model::create( const LQIO::DOM::Document * document, const std::string& inputFil
 	{ Pragma::Layering::BACKPROPOGATE_METHOD_OF_LAYERS, &BackPropogate_MOL_Model::create },
 	{ Pragma::Layering::SRVN,  			    &SRVN_Model::create },
 	{ Pragma::Layering::SQUASHED,  			    &Squashed_Model::create },
-	{ Pragma::Layering::HWSW,  			    &HwSw_Model::create }
+	{ Pragma::Layering::HWSW,  			    &HwSw_Model::create },
+	{ Pragma::Layering::JACOBI,  			    &Jacobi_Model::create }
     };
 
     Activity::clearConnectionMaps();
-    MVA::__bounds_limit = Pragma::tau();
 
     /*
      * Fold, Mutilate and Spindle before main loop processing in solve.c
@@ -492,8 +676,9 @@ Model::setModelParameters()
 
 Model::Model( const LQIO::DOM::Document * document, const std::string& inputFileName, const std::string& outputFileName, LQIO::DOM::Document::OutputFormat outputFormat )
     : _submodels(), _converged(false), _iterations(0), _MVAStats(),
-      _convergence_value(0), _iteration_limit(0), _underrelaxation(0),
-      _step_count(0), _model_initialized(false), _document(document),
+      _convergence_value(0), _iteration_limit(0), _underrelaxation(0), _relaxation(0), _last_delta(0),
+      _step_count(0), _warm_start(false), _solutions(), _total_iterations(),
+      _model_initialized(false), _document(document),
       _input_file_name(inputFileName), _output_file_name(outputFileName), _output_format(outputFormat)
 {
     __sync_submodel = 0;
@@ -712,7 +897,7 @@ void
 Model::initializeSubmodels()
 {
     if ( Pragma::interlock() ) {
-	std::for_each( __task.begin(), __task.end(), std::mem_fn( &Task::createInterlock ) );
+	createInterlock();
 	if ( Options::Debug::interlock() ) {
 	    Interlock::printPathTable( std::cout );
 	}
@@ -728,12 +913,49 @@ Model::initializeSubmodels()
     /* Initialize Interlocking -- must be done after all submodels initialized. */
 
     if ( Pragma::interlock() ) {
-	std::for_each( _submodels.begin(), _submodels.end(), std::mem_fn( &Submodel::initializeInterlock ) );
+	timeSubmodels( MVACount::Phase::INTERLOCK, &Submodel::initializeInterlock );
     }
     
     /* build stations and customers as needed. */
 
-    std::for_each( _submodels.begin(), _submodels.end(), std::mem_fn( &Submodel::build ) );      	    /* For use by MVA stats/generate*/
+    timeSubmodels( MVACount::Phase::BUILD, &Submodel::build );      	    /* For use by MVA stats/generate*/
+}
+
+
+
+/*
+ * Create the interlock paths of the tasks.  The time is charged to
+ * the submodel of the task.
+ */
+
+void
+Model::createInterlock()
+{
+    Interlock::Flow flow;
+    for ( auto task : __task ) {
+	const MVACount::Stopwatch clock;
+	task->createInterlock( flow );
+	if ( 0 < task->submodel() && task->submodel() <= _MVAStats.size() ) {
+	    _MVAStats[task->submodel()].time( MVACount::Phase::INTERLOCK, clock.elapsed() );
+	}
+    }
+}
+
+
+
+/*
+ * Run f for each submodel, charging the time to phase.
+ */
+
+template <typename Result>
+void
+Model::timeSubmodels( const MVACount::Phase phase, Result (Submodel::*f)() )
+{
+    for ( auto submodel : _submodels ) {
+	const MVACount::Stopwatch clock;
+	(submodel->*f)();
+	_MVAStats[submodel->number()].time( phase, clock.elapsed() );
+    }
 }
 
 
@@ -751,6 +973,7 @@ Model::reinitializeSubmodels()
      * reset to zero for the convergence test.
      */
 
+    _warm_start = Pragma::warmStart() && _converged;
     _iterations = 0;
     _step_count = 0;
 
@@ -763,24 +986,24 @@ Model::reinitializeSubmodels()
      * Reinitialize the MVA stuff
      */
 
-    std::for_each( __task.begin(),  __task.end(), std::mem_fn( &Task::createInterlock ) );
+    createInterlock();
 
     /*
      * Initialize waiting times and populations at servers Done in reverse
      * order (bottom up) because waits propogate upwards.
      */
 
-    std::for_each( _submodels.rbegin(), _submodels.rend(), std::mem_fn( &Submodel::reinitializeSubmodel ) );
+    std::for_each( _submodels.rbegin(), _submodels.rend(), [this]( Submodel * submodel ){ submodel->reinitializeSubmodel( _warm_start ); } );
 
     /* Reinitialize Interlocking */
 
     if ( Pragma::interlock() ) {
-	std::for_each( _submodels.begin(), _submodels.end(), std::mem_fn( &Submodel::initializeInterlock ) );
+	timeSubmodels( MVACount::Phase::INTERLOCK, &Submodel::initializeInterlock );
     }
     
     /* Rebuild stations and customers as needed. */
 
-    std::for_each( _submodels.begin(), _submodels.end(), std::mem_fn( &Submodel::rebuild ) );
+    timeSubmodels( MVACount::Phase::BUILD, &Submodel::rebuild );
 }
 
 
@@ -805,8 +1028,12 @@ Model::compute()
     report.start();
 
     _converged = false;
+    _relaxation = _underrelaxation;
+    _last_delta = 0.0;
     const double delta = run();
     report.finish( _converged, delta, _iterations );
+    _solutions[_warm_start] += 1;
+    _total_iterations[_warm_start] += _iterations;
     sanityCheck();
     if ( !_converged ) {
 	LQIO::runtime_error( ADV_SOLVER_ITERATION_LIMIT, _iterations, delta, convergenceValue() );
@@ -828,6 +1055,9 @@ Model::compute()
     if ( flags.print_overtaking ) {
 	printOvertaking( std::cout );
     }
+    if ( !SolverReport::__profile.empty() ) {
+	printProfile( report );
+    }
 
     if ( Generate::__mode != Generate::Output::NONE ) {
 	Generate::output( _submodels );
@@ -841,6 +1071,47 @@ Model::compute()
 
 
 
+/*
+ * Write the time by submodel and phase next to the results, e.g.,
+ * model.profile.csv.  Use stdout if the model came from stdin.
+ */
+
+void
+Model::printProfile( const SolverReport& report ) const
+{
+    const std::string& base = hasOutputFileName() ? _output_file_name : _input_file_name;
+    if ( base.empty() || base == "-" ) {
+	report.printProfile( std::cout, SolverReport::__profile );
+	return;
+    }
+
+    const std::string suffix = getDOM()->getResultInvocationNumber() > 0 ? SolverInterface::Solve::customSuffix : std::string("");
+    LQIO::Filename filename( base, "profile." + SolverReport::__profile, "", suffix );
+    std::ofstream output( filename().c_str() );
+    if ( !output ) {
+	LQIO::runtime_error( LQIO::ERR_CANT_OPEN_FILE, filename().c_str(), strerror( errno ) );
+    } else {
+	report.printProfile( output, SolverReport::__profile );
+    }
+}
+
+
+
+/*
+ * Print the number of solutions and their iterations by how they were
+ * started.
+ */
+
+std::ostream&
+Model::printStarts( std::ostream& output ) const
+{
+    output << LQIO::io_vars.lq_toolname << ": " << _solutions[0] << " cold start" << (_solutions[0] != 1 ? "s" : "") << ", " << _total_iterations[0] << " iterations; "
+	   << _solutions[1] << " warm start" << (_solutions[1] != 1 ? "s" : "") << ", " << _total_iterations[1] << " iterations." << std::endl;
+    return output;
+}
+
+
+
 /*
  * Output the results.
  */
@@ -902,8 +1173,33 @@ Model::underrelaxation() const
     if ( _iterations <= 1 ) {
 	return 1.0;
     } else {
-	return _underrelaxation;
+	return _relaxation;
+    }
+}
+
+
+
+/*
+ * For adaptive relaxation, damp the waits more when the change in
+ * utilization grows (the model is oscillating) and less when it
+ * shrinks, up to the value set for the model.  Small increases are
+ * noise, and halving the factor on each one stalls models that are
+ * converging slowly, so only cut back by a quarter when the change
+ * grows by more than ten percent.
+ */
+
+void
+Model::adaptUnderrelaxation( const double delta )
+{
+    if ( !Pragma::relaxation( Pragma::Relaxation::ADAPTIVE ) ) return;
+    if ( _iterations > 1 ) {
+	if ( delta > 1.1 * _last_delta ) {
+	    _relaxation = std::max( _relaxation * 0.75, 0.05 );
+	} else {
+	    _relaxation = std::min( _relaxation * 1.25, std::min( _underrelaxation, 1.0 ) );
+	}
     }
+    _last_delta = delta;
 }
 
 
@@ -1103,6 +1399,7 @@ MOL_Model::run()
 	    std::for_each( _submodels.begin(), &_submodels[_HWSubmodel], solveSubmodel );
 
 	    delta = sqrt( std::accumulate( __task.begin(), __task.end(), 0.0, []( double l, const Entity * r ){ return l + square( r->deltaUtilization() ); } ) / __task.size() );		/* RMS */
+	    adaptUnderrelaxation( delta );
 
 	    if ( delta > convergenceValue() ) {
 		backPropogate();
@@ -1239,7 +1536,7 @@ Batch_Model::run()
 	_iterations += 1;
 	if ( verbose ) std::cerr << "Iteration: " << _iterations << " ";
 
-	std::for_each( _submodels.begin(), _submodels.end(), SolveSubmodel( *this, verbose ) );
+	solveSubmodels( verbose );
 
 	/* compute convergence for next pass. */
 
@@ -1247,6 +1544,7 @@ Batch_Model::run()
 				       std::accumulate( __task.begin(), __task.end(), 0.0,
 							[]( double l, const Entity * r ){ return l + square( r->deltaUtilization() ); } ),
 				       []( double l, const Entity * r ){ return l + square( r->deltaUtilization() ); } ) / count );		/* RMS */
+	adaptUnderrelaxation( delta );
 
 	if ( delta > convergenceValue() ) {
 	    backPropogate();
@@ -1270,6 +1568,17 @@ Batch_Model::run()
     return delta;
 }
 
+/*
+ * Solve the submodels from top to bottom.  Each one sees the waits
+ * computed by the ones solved before it (Gauss-Seidel).
+ */
+
+void
+Batch_Model::solveSubmodels( const bool verbose )
+{
+    std::for_each( _submodels.begin(), _submodels.end(), SolveSubmodel( *this, verbose ) );
+}
+
 /*----------------------------------------------------------------------*/
 /*                      Back Propogate Batch Model                      */
 /*----------------------------------------------------------------------*/
@@ -1391,6 +1700,56 @@ HwSw_Model::assignSubmodel()
     return 2;
 }
 
+/*----------------------------------------------------------------------*/
+/*                            Jacobi Model                              */
+/*----------------------------------------------------------------------*/
+
+/*
+ * Solve all of the submodels using the waits and think times from the
+ * previous iteration.  The stations of every submodel are set up
+ * first, then the MVA models are solved at the same time with one
+ * thread per core (mva-threads only sets the threads used within each
+ * solver), then the results are saved from top to bottom.
+ * Submodels that can't be split this way (the synchronization
+ * submodel and those with PAN replication) are solved in the last
+ * step, in order, as with batched layering.  The tasks on the pool
+ * only read the stations and MVA models of their submodel; the
+ * pragmas, error count and input file name they need for messages
+ * are handed over from this thread.
+ */
+
+void
+Jacobi_Model::solveSubmodels( const bool verbose )
+{
+    std::vector<Submodel *> staged;
+    for ( Vector<Submodel *>::const_iterator submodel = _submodels.begin(); submodel != _submodels.end(); ++submodel ) {
+	if ( !(*submodel)->isStaged() ) continue;
+	(*submodel)->start( _iterations, _MVAStats[(*submodel)->number()] );
+	staged.push_back( *submodel );
+    }
+
+    const Pragma * cache = Pragma::current();
+    const std::string& file_name = LQIO::DOM::Document::__input_file_name;
+    std::atomic<unsigned> errors( 0 );
+    MVA::threadPool( 0 )->run( staged.size(), [&]( const size_t i, const unsigned ) {
+	    const Pragma::Use use( cache );
+	    const LQIO::DOM::Document::InputFileName name( file_name );
+	    const LQIO::lqio_params_stats::Count count( errors );
+	    staged[i]->solveModels( _MVAStats[staged[i]->number()] );
+	} );
+    LQIO::io_vars.error_count += errors;
+
+    for ( Vector<Submodel *>::const_iterator submodel = _submodels.begin(); submodel != _submodels.end(); ++submodel ) {
+	if ( (*submodel)->isStaged() ) {
+	    _step_count += 1;
+	    if ( verbose ) std::cerr << ".";
+	    (*submodel)->finish( _iterations, _MVAStats[(*submodel)->number()], underrelaxation() );
+	} else {
+	    SolveSubmodel( *this, verbose )( *submodel );
+	}
+    }
+}
+
 /*
  * Solve a single sub-model.
  */
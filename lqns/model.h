@@ -17,7 +17,10 @@
 #ifndef LQNS_MODEL_H
 #define	LQNS_MODEL_H
 
+#include <functional>
+#include <mutex>
 #include <set>
+#include <vector>
 #include <lqio/dom_document.h>
 #include <mva/vector.h>
 #include "report.h"
@@ -70,10 +73,16 @@ public:
 public:
     static LQIO::DOM::Document* load( const std::string& inputFileName, const std::string& outputFileName );
     static int solve( solve_using, const std::string&, const std::string&, LQIO::DOM::Document::OutputFormat );
+    static int solve( solve_using, LQIO::DOM::Document *, const std::string&, const std::string&, LQIO::DOM::Document::OutputFormat );
+    static int solve( solve_using, const std::vector<std::string>&, const std::string&, LQIO::DOM::Document::OutputFormat, unsigned );
+    static int solve( solve_using, const std::vector<LQIO::DOM::Document *>&, const std::vector<std::string>&, const std::string&, LQIO::DOM::Document::OutputFormat, unsigned );
     void recalculateDynamicValues();
 
 private:
     static bool prepare( const LQIO::DOM::Document* document );
+    static int solveBatch( const size_t, const unsigned, const std::function<int(const size_t)>& );
+    static void setLibraryParameters();
+    static void warnLibraryParameters( const LQIO::DOM::Document *, const std::string& );
     static Model * create( const LQIO::DOM::Document *, const std::string&, const std::string&, LQIO::DOM::Document::OutputFormat );
     void setModelParameters();
 
@@ -94,6 +103,8 @@ public:
     void insertDOMResults() const;
 
     std::ostream& printSubmodelWait( std::ostream& output = std::cout ) const;
+    std::ostream& printStarts( std::ostream& ) const;
+    void printProfile( const SolverReport& ) const;
 
 protected:
     const LQIO::DOM::Document * getDOM() const { return _document; }
@@ -104,10 +115,13 @@ protected:
     virtual void partition() {}		// Partition disjoin chains.
     void initializeSubmodels();
     void reinitializeSubmodels();
+    void createInterlock();
+    template <typename Result> void timeSubmodels( const MVACount::Phase, Result (Submodel::*)() );
 
     double convergenceValue() const { return _convergence_value; }	/* Cached */
     unsigned iterationLimit() const { return _iteration_limit; }
     double underrelaxation() const;					/* Cached */
+    void adaptUnderrelaxation( const double );
     unsigned printInterval() const { return __print_interval; }
 
     virtual void backPropogate() {}
@@ -127,12 +141,15 @@ private:
 
 public:
     static LQIO::DOM::Document::InputFormat __input_format;
-    static std::set<Processor *,lt_replica<Processor>> __processor;
-    static std::set<Group *,lt_replica<Group>> __group;
-    static std::set<Task *,lt_replica<Task>> __task;
-    static std::set<Entry *,lt_replica<Entry>> __entry;
-    static Processor * __think_server;	/* Delay server for think times	*/
+    /* The model being solved by this thread. */
+    static thread_local std::set<Processor *,lt_replica<Processor>> __processor;
+    static thread_local std::set<Group *,lt_replica<Group>> __group;
+    static thread_local std::set<Task *,lt_replica<Task>> __task;
+    static thread_local std::set<Entry *,lt_replica<Entry>> __entry;
+    static thread_local Processor * __think_server;	/* Delay server for think times	*/
     static unsigned __print_interval;	/* for option processing	*/
+    static bool __batch;		/* Solving many models at once.	*/
+    static std::mutex __output_mutex;	/* Serializes batch messages.	*/
 
 protected:
     Vector<Submodel *> _submodels;
@@ -143,12 +160,17 @@ protected:
     double _convergence_value;		/* Cached */
     unsigned _iteration_limit;		/* Cached */
     double _underrelaxation;		/* Cached */
+    double _relaxation;			/* Current, if adaptive.	*/
+    double _last_delta;			/* For adaptive relaxation.	*/
     
 protected:
-    static unsigned __sync_submodel;	/* Level of special sync model. */
+    static thread_local unsigned __sync_submodel;	/* Level of special sync model. */
+    unsigned long _step_count;		/* Number of solveLayers	*/
     
 private:
-    unsigned long _step_count;		/* Number of solveLayers	*/
+    bool _warm_start;			/* Started from last solution.	*/
+    unsigned long _solutions[2];	/* Solutions by cold/warm start	*/
+    unsigned long _total_iterations[2];	/* Iterations by cold/warm start */
     bool _model_initialized;
     const LQIO::DOM::Document * _document;
     const std::string _input_file_name;
@@ -208,6 +230,7 @@ protected:
     virtual void addToSubmodel();
     virtual void partition();
     virtual double run();
+    virtual void solveSubmodels( const bool );
 };
 
 
@@ -263,4 +286,17 @@ protected:
 
     virtual unsigned assignSubmodel();
 };
+
+/* ---------------------- Jacobi Partition Model ---------------------- */
+                        
+class Jacobi_Model : public Batch_Model {
+    friend class Model;		/* Allows use of constructor within class Model */
+
+protected:
+    Jacobi_Model( const LQIO::DOM::Document * document, const std::string& inputFileName, const std::string& outputFileName, LQIO::DOM::Document::OutputFormat outputFormat ) : Batch_Model( document, inputFileName, outputFileName, outputFormat ) {}
+
+    static Model * create( const LQIO::DOM::Document * document, const std::string& inputFileName, const std::string& outputFileName, LQIO::DOM::Document::OutputFormat outputFormat ) { return new Jacobi_Model( document, inputFileName, outputFileName, outputFormat ); }
+
+    virtual void solveSubmodels( const bool );
+};
 #endif
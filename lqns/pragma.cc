@@ -19,10 +19,11 @@
 #include "pragma.h"
 
 LQIO::DOM::Pragma pragmas;
-Pragma * Pragma::__cache = nullptr;
+thread_local Pragma * Pragma::__cache = nullptr;
 const std::map<const std::string,const Pragma::fptr> Pragma::__set_pragma =
 {
     { LQIO::DOM::Pragma::_convergence_value_,		&Pragma::setConvergenceValue },
+    { LQIO::DOM::Pragma::_conway_limit_,		&Pragma::setConwayLimit },
     { LQIO::DOM::Pragma::_cycles_,			&Pragma::setAllowCycles },
     { LQIO::DOM::Pragma::_force_infinite_,		&Pragma::setForceInfinite },
     { LQIO::DOM::Pragma::_force_multiserver_,		&Pragma::setForceMultiserver },
@@ -32,6 +33,8 @@ const std::map<const std::string,const Pragma::fptr> Pragma::__set_pragma =
     { LQIO::DOM::Pragma::_mol_underrelaxation_,		&Pragma::setMOLUnderrelaxation },
     { LQIO::DOM::Pragma::_multiserver_,			&Pragma::setMultiserver },
     { LQIO::DOM::Pragma::_mva_,				&Pragma::setMva },
+    { LQIO::DOM::Pragma::_mva_anderson_,		&Pragma::setMvaAnderson },
+    { LQIO::DOM::Pragma::_mva_threads_,			&Pragma::setMvaThreads },
     { LQIO::DOM::Pragma::_overtaking_,			&Pragma::setOvertaking },
     { LQIO::DOM::Pragma::_processor_scheduling_,	&Pragma::setProcessorScheduling },
 #if HAVE_LIBGSL && HAVE_LIBGSLCBLAS
@@ -39,23 +42,27 @@ const std::map<const std::string,const Pragma::fptr> Pragma::__set_pragma =
     { LQIO::DOM::Pragma::_quorum_delayed_calls_,	&Pragma::setQuorumDelayedCalls },
     { LQIO::DOM::Pragma::_quorum_idle_time_,		&Pragma::setQuorumIdleTime },
 #endif
+    { LQIO::DOM::Pragma::_relaxation_,			&Pragma::setRelaxation },
     { LQIO::DOM::Pragma::_replication_,			&Pragma::setReplication },
 #if RESCHEDULE
     { LQIO::DOM::Pragma::_reschedule_on_async_send_,	&Pragma::setRescheduleOnAsyncSend },
 #endif
     { LQIO::DOM::Pragma::_save_marginal_probabilities_, &Pragma::setSaveMarginalProbabilities },
     { LQIO::DOM::Pragma::_severity_level_,		&Pragma::setSeverityLevel },
+    { LQIO::DOM::Pragma::_skip_converged_,		&Pragma::setSkipConverged },
     { LQIO::DOM::Pragma::_spex_comment_,		&Pragma::setSpexComment },
     { LQIO::DOM::Pragma::_spex_convergence_,		&Pragma::setSpexConvergence },
     { LQIO::DOM::Pragma::_spex_header_,			&Pragma::setSpexHeader },
     { LQIO::DOM::Pragma::_spex_iteration_limit_,	&Pragma::setSpexIterationLimit },
     { LQIO::DOM::Pragma::_spex_underrelaxation_,	&Pragma::setSpexUnderrelaxation },
+    { LQIO::DOM::Pragma::_split_submodels_,		&Pragma::setSplitSubmodels },
     { LQIO::DOM::Pragma::_stop_on_bogus_utilization_,	&Pragma::setStopOnBogusUtilization },
     { LQIO::DOM::Pragma::_stop_on_message_loss_,	&Pragma::setStopOnMessageLoss },
     { LQIO::DOM::Pragma::_task_scheduling_,		&Pragma::setTaskScheduling },
     { LQIO::DOM::Pragma::_tau_,				&Pragma::setTau },
     { LQIO::DOM::Pragma::_threads_,			&Pragma::setThreads },
-    { LQIO::DOM::Pragma::_variance_,			&Pragma::setVariance }
+    { LQIO::DOM::Pragma::_variance_,			&Pragma::setVariance },
+    { LQIO::DOM::Pragma::_warm_start_,			&Pragma::setWarmStart }
 };
 
 /*
@@ -65,6 +72,7 @@ const std::map<const std::string,const Pragma::fptr> Pragma::__set_pragma =
 Pragma::Pragma() :
     _allow_cycles(false),
     _convergence_value(0.0),
+    _conway_limit(0),
     _exponential_paths(false),
     _force_infinite(ForceInfinite::NONE),
     _force_multiserver(ForceMultiserver::NONE),
@@ -74,6 +82,8 @@ Pragma::Pragma() :
     _mol_underrelaxation(0.5),
     _multiserver(Multiserver::DEFAULT),
     _mva(MVA::LINEARIZER),
+    _mva_anderson(0),
+    _mva_threads(1),
     _overtaking(Overtaking::MARKOV),
     _processor_scheduling(SCHEDULE_PS),
 #if BUG_270
@@ -84,17 +94,20 @@ Pragma::Pragma() :
     _quorum_delayed_calls(QuorumDelayedCalls::DEFAULT),
     _quorum_idle_time(QuorumIdleTime::DEFAULT),
 #endif
+    _relaxation(Relaxation::FIXED),
     _replication(Replication::EXPAND),
 #if RESCHEDULE
     _reschedule_on_async_send(false),
 #endif
     _save_marginal_probabilities(false),
     _severity_level(LQIO::error_severity::ALL),
+    _skip_converged(0),
     _spex_comment(false),
     _spex_convergence(0.0),
     _spex_header(true),
     _spex_iteration_limit(0),
     _spex_underrelaxation(1.0),
+    _split_submodels(false),
     _stop_on_bogus_utilization(0.),		/* Not a bool.	U > nn */
     _stop_on_message_loss(true),
     _task_scheduling(SCHEDULE_FIFO),
@@ -102,6 +115,7 @@ Pragma::Pragma() :
     _threads(Threads::HYPER),
     _underrelaxation(0.),
     _variance(Variance::DEFAULT),
+    _warm_start(false),
     /* Bonus */
     _default_processor_scheduling(true),
     _default_task_scheduling(true),
@@ -137,6 +151,18 @@ Pragma::set( const std::map<std::string,std::string>& list )
 
 
 
+/*
+ * Free the pragmas of this thread.
+ */
+
+void
+Pragma::clear()
+{
+    delete __cache;
+}
+
+
+
 void Pragma::setAllowCycles(const std::string& value )
 {
     _allow_cycles = LQIO::DOM::Pragma::isTrue(value );
@@ -150,6 +176,18 @@ void Pragma::setConvergenceValue(const std::string& value )
     if ( (_convergence_value <= 0 || 1 < _convergence_value ) || *endptr != '\0' ) throw std::domain_error( value );
 }
 
+/*
+ * Number of populations a Conway multiserver will sum over before
+ * using the Rolia approximation instead.  Zero means no limit.
+ */
+
+void Pragma::setConwayLimit(const std::string& value )
+{
+    char * endptr = nullptr;
+    _conway_limit = std::strtoul( value.c_str(), &endptr, 10 );
+    if ( *endptr != '\0' ) throw std::domain_error( value );
+}
+
 void Pragma::setForceInfinite(const std::string& value )
 {
     static const std::map<const std::string,const ForceInfinite> __force_infinite_pragma = {
@@ -205,6 +243,7 @@ const std::map<const std::string,const Pragma::Layering> Pragma::__layering_prag
     { LQIO::DOM::Pragma::_batched_,		Pragma::Layering::BATCHED },
     { LQIO::DOM::Pragma::_batched_back_,	Pragma::Layering::BACKPROPOGATE_BATCHED },
     { LQIO::DOM::Pragma::_hwsw_,		Pragma::Layering::HWSW },
+    { LQIO::DOM::Pragma::_jacobi_,		Pragma::Layering::JACOBI },
     { LQIO::DOM::Pragma::_mol_,			Pragma::Layering::METHOD_OF_LAYERS },
     { LQIO::DOM::Pragma::_mol_back_,		Pragma::Layering::BACKPROPOGATE_METHOD_OF_LAYERS },
     { LQIO::DOM::Pragma::_processor_,		Pragma::Layering::BATCHED },	/* For lqn2ps	*/
@@ -289,6 +328,32 @@ void Pragma::setMva(const std::string& value )
 }
 
 
+/*
+ * Depth of Anderson acceleration used by the Schweitzer core of the
+ * approximate MVA solvers.  Zero turns it off.
+ */
+
+void Pragma::setMvaAnderson(const std::string& value )
+{
+    char * endptr = nullptr;
+    _mva_anderson = std::strtoul( value.c_str(), &endptr, 10 );
+    if ( *endptr != '\0' ) throw std::domain_error( value );
+}
+
+
+/*
+ * Number of threads used by Linearizer for the reduced populations.
+ * Zero means use all cores.
+ */
+
+void Pragma::setMvaThreads(const std::string& value )
+{
+    char * endptr = nullptr;
+    _mva_threads = std::strtoul( value.c_str(), &endptr, 10 );
+    if ( *endptr != '\0' ) throw std::domain_error( value );
+}
+
+
 void Pragma::setOvertaking(const std::string& value )
 {
     static const std::map<const std::string,const Pragma::Overtaking> __overtaking_pragma = {
@@ -393,6 +458,27 @@ void Pragma::setQuorumIdleTime(const std::string& value )
 #endif
 
 
+/*
+ * How the waits are relaxed between iterations of the layers.
+ */
+
+void Pragma::setRelaxation(const std::string& value )
+{
+    static const std::map<const std::string,const Pragma::Relaxation> __relaxation_pragma = {
+	{ LQIO::DOM::Pragma::_adaptive_,	Pragma::Relaxation::ADAPTIVE },
+	{ LQIO::DOM::Pragma::_anderson_,	Pragma::Relaxation::ANDERSON },
+	{ LQIO::DOM::Pragma::_fixed_,		Pragma::Relaxation::FIXED }
+    };
+
+    const std::map<const std::string,const Pragma::Relaxation>::const_iterator pragma = __relaxation_pragma.find( value );
+    if ( pragma != __relaxation_pragma.end() ) {
+	_relaxation = pragma->second;
+    } else {
+	throw std::invalid_argument( value );
+    }
+}
+
+
 void Pragma::setReplication(const std::string& value )
 {
     static const std::map<const std::string,const Pragma::Replication> __replication_pragma = {
@@ -427,6 +513,19 @@ void Pragma::setSaveMarginalProbabilities(const std::string& value )
 
 
 
+/*
+ * Skip submodels whose inputs have not changed, but solve all of them
+ * every n iterations.  Zero never skips.
+ */
+
+void Pragma::setSkipConverged(const std::string& value )
+{
+    char * endptr = nullptr;
+    _skip_converged = std::strtoul( value.c_str(), &endptr, 10 );
+    if ( *endptr != '\0' ) throw std::domain_error( value );
+}
+
+
 void Pragma::setSpexComment(const std::string& value )
 {
     _spex_comment = LQIO::DOM::Pragma::isTrue( value );
@@ -468,6 +567,17 @@ void Pragma::setSeverityLevel(const std::string& value )
 }
 
 
+/*
+ * Solve the disjoint groups of clients and servers of a submodel with
+ * solvers of their own.
+ */
+
+void Pragma::setSplitSubmodels(const std::string& value )
+{
+    _split_submodels = LQIO::DOM::Pragma::isTrue( value );
+}
+
+
 void Pragma::setStopOnBogusUtilization(const std::string& value )
 {
     char * endptr = nullptr;
@@ -555,6 +665,12 @@ void Pragma::setVariance(const std::string& value )
 	throw std::invalid_argument( value );
     }
 }
+
+
+void Pragma::setWarmStart(const std::string& value )
+{
+    _warm_start = LQIO::DOM::Pragma::isTrue( value );
+}
 
 /*
  * Print out available pragmas.
@@ -565,8 +681,12 @@ Pragma::usage( std::ostream& output )
 {
     static const std::map<const std::string, const std::string> default_args = {
 	{ LQIO::DOM::Pragma::_convergence_value_,	    "<n.n>" },
+	{ LQIO::DOM::Pragma::_conway_limit_,		    "<n>" },
 	{ LQIO::DOM::Pragma::_iteration_limit_,		    "<n>" },
 	{ LQIO::DOM::Pragma::_mol_underrelaxation_,	    "<n.n>" },
+	{ LQIO::DOM::Pragma::_mva_anderson_,		    "<n>" },
+	{ LQIO::DOM::Pragma::_mva_threads_,		    "<n>" },
+	{ LQIO::DOM::Pragma::_skip_converged_,		    "<n>" },
 	{ LQIO::DOM::Pragma::_spex_convergence_,	    "<n.n>" },
 	{ LQIO::DOM::Pragma::_spex_iteration_limit_,	    "<n>" },
 	{ LQIO::DOM::Pragma::_spex_underrelaxation_,	    "<n.n>" },
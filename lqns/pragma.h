@@ -35,7 +35,7 @@ public:
 
     enum class ForceInfinite { NONE, FIXED_RATE, MULTISERVERS, ALL };
     enum class ForceMultiserver { NONE, PROCESSORS, TASKS, ALL };
-    enum class Layering { BACKPROPOGATE_BATCHED, BATCHED, METHOD_OF_LAYERS, BACKPROPOGATE_METHOD_OF_LAYERS, SRVN, SQUASHED, HWSW };
+    enum class Layering { BACKPROPOGATE_BATCHED, BATCHED, METHOD_OF_LAYERS, BACKPROPOGATE_METHOD_OF_LAYERS, SRVN, SQUASHED, HWSW, JACOBI };
     enum class MVA { LINEARIZER, EXACT, SCHWEITZER, FAST, ONESTEP, ONESTEP_LINEARIZER };
     enum class Multiserver { DEFAULT, CONWAY, EXPERIMENTAL, REISER, REISER_PS, ROLIA, ROLIA_PS, BRUELL, SCHMIDT, SURI, ZHOU };
     enum class Overtaking { MARKOV, ROLIA, SIMPLE, SPECIAL, NONE };
@@ -44,6 +44,7 @@ public:
     enum class QuorumDelayedCalls { DEFAULT, KEEP_ALL, ABORT_ALL, ABORT_LOCAL_ONLY, ABORT_REMOTE_ONLY };
     enum class QuorumIdleTime { DEFAULT, JOINDELAY, ROOTENTRY };
 #endif
+    enum class Relaxation { FIXED, ADAPTIVE, ANDERSON };
     enum class Replication { EXPAND, PRUNE, PAN };
     enum class Threads { MAK_LUNDSTROM, HYPER, NONE };
     enum class Variance { DEFAULT, NONE, STOCHASTIC, MOL };
@@ -62,12 +63,18 @@ public:
 	    return __cache->_allow_cycles;
 	}
 
-    static unsigned int convergenceValue()
+    static double convergenceValue()
 	{
 	    assert( __cache != nullptr );
 	    return __cache->_convergence_value;
 	}
 
+    static unsigned long conwayLimit()
+	{
+	    assert( __cache != nullptr );
+	    return __cache->_conway_limit;
+	}
+
     static bool exponential_paths()
 	{
 	    assert( __cache != nullptr );
@@ -126,6 +133,18 @@ public:
 	    return __cache->_mva;
 	}
 
+    static unsigned int mvaAnderson()
+	{
+	    assert( __cache != nullptr );
+	    return __cache->_mva_anderson;
+	}
+
+    static unsigned int mvaThreads()
+	{
+	    assert( __cache != nullptr );
+	    return __cache->_mva_threads;
+	}
+
     static Overtaking overtaking()
 	{
 	    assert( __cache != nullptr );
@@ -176,6 +195,17 @@ public:
 	}
 #endif
 
+    static Relaxation relaxation()
+	{
+	    assert( __cache != nullptr );
+	    return __cache->_relaxation;
+	}
+
+    static bool relaxation( Relaxation arg )
+	{
+	    return relaxation() == arg;
+	}
+
     static Replication replication()
 	{
 	    assert( __cache != nullptr );
@@ -203,6 +233,12 @@ public:
 	    return __cache->_severity_level;
 	}
 
+    static unsigned int skipConverged()
+	{
+	    assert( __cache != nullptr );
+	    return __cache->_skip_converged;
+	}
+
     static bool spexComment()
 	{
 	    assert( __cache != nullptr );
@@ -233,6 +269,12 @@ public:
 	    return __cache->_spex_underrelaxation;
 	}
 
+    static bool splitSubmodels()
+	{
+	    assert( __cache != nullptr );
+	    return __cache->_split_submodels;
+	}
+
     static bool stopOnMessageLoss()
 	{
 	    assert( __cache != nullptr );
@@ -304,9 +346,16 @@ public:
 	    return __cache->_init_variance_only;
 	}
 
+    static bool warmStart()
+	{
+	    assert( __cache != nullptr );
+	    return __cache->_warm_start;
+	}
+
 private:
     void setAllowCycles(const std::string&);
     void setConvergenceValue(const std::string&);
+    void setConwayLimit(const std::string&);
     void setExponential_paths(const std::string&);
     void setForceInfinite(const std::string&);
     void setForceMultiserver(const std::string&);
@@ -316,6 +365,8 @@ private:
     void setMOLUnderrelaxation(const std::string&);
     void setMultiserver(const std::string&);
     void setMva(const std::string&);
+    void setMvaAnderson(const std::string&);
+    void setMvaThreads(const std::string&);
     void setOvertaking(const std::string&);
     void setProcessorScheduling(const std::string&);
 #if BUG_270
@@ -326,17 +377,20 @@ private:
     void setQuorumDelayedCalls(const std::string&);
     void setQuorumIdleTime(const std::string&);
 #endif
+    void setRelaxation(const std::string&);
     void setReplication(const std::string&);
 #if RESCHEDULE
     void setRescheduleOnAsyncSend(const std::string&);
 #endif
     void setSaveMarginalProbabilities(const std::string&);
     void setSeverityLevel(const std::string&);
+    void setSkipConverged(const std::string&);
     void setSpexComment(const std::string&);
     void setSpexConvergence(const std::string&);
     void setSpexHeader(const std::string&);
     void setSpexIterationLimit(const std::string&);
     void setSpexUnderrelaxation(const std::string&);
+    void setSplitSubmodels(const std::string&);
     void setStopOnBogusUtilization(const std::string&);
     void setStopOnMessageLoss(const std::string&);
     void setTaskScheduling(const std::string&);
@@ -344,15 +398,35 @@ private:
     void setThreads(const std::string&);
     void setUnderrelaxation(const std::string&);
     void setVariance(const std::string&);
+    void setWarmStart(const std::string&);
 
 public:
     static void set( const std::map<std::string,std::string>& );
+    static void clear();
     static std::ostream& usage( std::ostream&  );
     static const std::map<const std::string,const Pragma::fptr>& getPragmas() { return __set_pragma; }
 
+    /*
+     * The pragmas are kept per thread.  A task run on the MVA thread
+     * pool uses those of the thread that started it.
+     */
+
+    class Use {
+    public:
+	explicit Use( const Pragma * cache ) : _saved(__cache) { __cache = const_cast<Pragma *>(cache); }
+	~Use() { __cache = _saved; }
+    private:
+	Use( const Use& ) = delete;
+	Use& operator=( const Use& ) = delete;
+	Pragma * _saved;
+    };
+
+    static const Pragma * current() { return __cache; }
+
 private:
     bool _allow_cycles;
     double _convergence_value;
+    unsigned long _conway_limit;
     bool _exponential_paths;
     ForceInfinite _force_infinite;
     ForceMultiserver _force_multiserver;
@@ -362,6 +436,8 @@ private:
     double _mol_underrelaxation;
     Multiserver _multiserver;
     MVA _mva;
+    unsigned int _mva_anderson;
+    unsigned int _mva_threads;
     Overtaking _overtaking;
     scheduling_type _processor_scheduling;
 #if BUG_270
@@ -372,17 +448,20 @@ private:
     QuorumDelayedCalls _quorum_delayed_calls;
     QuorumIdleTime _quorum_idle_time;
 #endif
+    Relaxation _relaxation;
     Replication _replication;
 #if RESCHEDULE
     bool _reschedule_on_async_send;
 #endif
     bool _save_marginal_probabilities;
     LQIO::error_severity _severity_level;
+    unsigned int _skip_converged;
     bool _spex_comment;
     double _spex_convergence;
     bool _spex_header;
     unsigned int _spex_iteration_limit;
     double _spex_underrelaxation;
+    bool _split_submodels;
     double _stop_on_bogus_utilization;
     bool _stop_on_message_loss;
     scheduling_type _task_scheduling;
@@ -390,6 +469,7 @@ private:
     Threads _threads;
     double _underrelaxation;
     Variance _variance;
+    bool _warm_start;
     /* bonus */
     bool _default_processor_scheduling;
     bool _default_task_scheduling;
@@ -398,7 +478,7 @@ private:
 
     /* --- */
 
-    static Pragma * __cache;
+    static thread_local Pragma * __cache;
     static const std::map<const std::string,const Pragma::fptr> __set_pragma;
     static const std::map<const std::string,const Pragma::Layering> __layering_pragma;
     static const std::map<const std::string,const Pragma::Multiserver> __multiserver_pragma;
@@ -28,6 +28,10 @@
 #include "flags.h"
 #include "report.h"
 
+std::string SolverReport::__profile;
+
+const std::array<const char *,6> MVACount::__phase_name = { "build", "interlock", "closed", "open", "save", "update-wait" };
+
 int
 operator==( const MVACount& a, const MVACount& b )
 {
@@ -71,6 +75,33 @@ stddev( const double n, const double sum, const double sum_sqr )
     return 0.0;
 }
 
+/*
+ * Add one timing.
+ */
+
+PhaseTime&
+PhaseTime::operator+=( const double elapsed )
+{
+    _n += 1;
+    _total += elapsed;
+    _max = std::max( _max, elapsed );
+    return *this;
+}
+
+
+/*
+ * Accumulate the times of another submodel for the total.
+ */
+
+PhaseTime&
+PhaseTime::operator+=( const PhaseTime& arg )
+{
+    _n += arg._n;
+    _total += arg._total;
+    _max = std::max( _max, arg._max );
+    return *this;
+}
+
 /*
  * Reset all counters.
  */
@@ -78,7 +109,9 @@ stddev( const double n, const double sum, const double sum_sqr )
 MVACount&
 MVACount::initialize()
 {
-    _n = 0; _k = 0; _s = 0; step = 0; step_sqr = 0; wait = 0; wait_sqr = 0; faults = 0; 
+    _n = 0; _k = 0; _s = 0; step = 0; step_sqr = 0; wait = 0; wait_sqr = 0; faults = 0; skipped = 0;
+    group_step.clear();
+    _phase.fill( PhaseTime() );
     _total_time = 0;
     return *this;
 }
@@ -165,6 +198,10 @@ MVACount::operator+=( const MVACount& arg )
     wait      += arg.wait;				
     wait_sqr  += arg.wait_sqr;			
     faults    += arg.faults;
+    skipped   += arg.skipped;
+    for ( size_t i = 0; i < _phase.size(); ++i ) {
+	_phase[i] += arg._phase[i];
+    }
 
     _total_time  += arg._total_time;
     return *this;
@@ -186,6 +223,9 @@ MVACount::operator=( const MVACount& arg )
     wait      = arg.wait;				
     wait_sqr  = arg.wait_sqr;			
     faults    = arg.faults;
+    skipped   = arg.skipped;
+    group_step = arg.group_step;
+    _phase     = arg._phase;
 
     _total_time  = arg._total_time;
 
@@ -193,6 +233,29 @@ MVACount::operator=( const MVACount& arg )
 }
 
 
+/*
+ * Print the wall clock time by phase, one line per phase.
+ */
+
+std::ostream&
+MVACount::printProfile( std::ostream& output ) const
+{
+    const unsigned precision = output.precision(5);
+    std::ios_base::fmtflags flags = output.setf( std::ios::right, std::ios::adjustfield );
+    for ( size_t i = 0; i < _phase.size(); ++i ) {
+	if ( _phase[i].count() == 0 ) continue;
+	output << "     " << std::setw(12) << std::left << __phase_name[i] << std::right
+	       << std::setw(10) << _phase[i].count() << " "
+	       << std::setw(10) << _phase[i].total() << " "
+	       << std::setw(10) << _phase[i].mean() << " "
+	       << std::setw(10) << _phase[i].max() << std::endl;
+    }
+    output.precision(precision);
+    output.flags(flags);
+    return output;
+}
+
+
 /*
  * Accumualate a record.
  */
@@ -212,6 +275,23 @@ MVACount::accumulate( const unsigned long iterations, const unsigned long inflat
     _total_time += stop_time  - _start_time;
     return *this;
 }
+
+
+
+/*
+ * Accumulate the steps of disjoint group g of a submodel.  The
+ * record itself is accumulated once for all groups.
+ */
+
+MVACount&
+MVACount::accumulateGroup( const unsigned g, const unsigned long iterations )
+{
+    if ( group_step.size() < g ) {
+	group_step.resize( g, 0.0 );
+    }
+    group_step[g-1] += iterations;
+    return *this;
+}
 
 SolverReport::SolverReport( LQIO::DOM::Document * document, const Vector<MVACount>& stats )
     : _document(document), _valid(false), _iterations(0), _convergenceValue(0.0), _faultCount(0),
@@ -281,8 +361,30 @@ SolverReport::print( std::ostream& output ) const
 
     for ( unsigned i = 1; i <= MVAStats.size(); ++i ) {
 	output << std::setw(3) << i << "  " << MVAStats[i] << std::endl;
+	if ( MVAStats[i].group_step.size() > 1 ) {
+	    output << "     group step():";
+	    for ( const auto step : MVAStats[i].group_step ) {
+		output << " " << step;
+	    }
+	    output << std::endl;
+	}
+	if ( MVAStats[i].skipped > 0 ) {
+	    output << "     solved: " << MVAStats[i]._n << ", skipped: " << MVAStats[i].skipped << std::endl;
+	}
     }
     output << "Total" << total << std::endl;
+    if ( total.skipped > 0 ) {
+	output << "     solved: " << total._n << ", skipped: " << total.skipped << std::endl;
+    }
+
+    output << std::endl << "Wall clock time by phase (seconds): " << std::endl;
+    output << "Submdl phase              n      total       mean        max" << std::endl;
+    for ( unsigned i = 1; i <= MVAStats.size(); ++i ) {
+	output << std::setw(3) << i << std::endl;
+	MVAStats[i].printProfile( output );
+    }
+    output << "Total" << std::endl;
+    total.printProfile( output );
 
     output << std::endl;
 #if HAVE_SYS_UTSNAME_H
@@ -315,6 +417,44 @@ SolverReport::print( std::ostream& output ) const
 
 
 
+/*
+ * Print the wall clock time by submodel and phase as CSV or JSON.
+ * Submodel 0 is the total.
+ */
+
+std::ostream&
+SolverReport::printProfile( std::ostream& output, const std::string& format ) const
+{
+    const bool json = format == "json";
+    if ( json ) {
+	output << "[" << std::endl;
+    } else {
+	output << "submodel,phase,n,total,mean,max" << std::endl;
+    }
+    bool first = true;
+    for ( unsigned i = 0; i <= MVAStats.size(); ++i ) {
+	const MVACount& count = i == 0 ? total : MVAStats[i];
+	for ( size_t j = 0; j < count._phase.size(); ++j ) {
+	    const PhaseTime& phase = count._phase[j];
+	    if ( phase.count() == 0 ) continue;
+	    if ( json ) {
+		if ( !first ) output << "," << std::endl;
+		output << "  { \"submodel\": " << i << ", \"phase\": \"" << MVACount::__phase_name[j] << "\", \"n\": " << phase.count()
+		       << ", \"total\": " << phase.total() << ", \"mean\": " << phase.mean() << ", \"max\": " << phase.max() << " }";
+	    } else {
+		output << i << "," << MVACount::__phase_name[j] << "," << phase.count() << "," << phase.total() << "," << phase.mean() << "," << phase.max() << std::endl;
+	    }
+	    first = false;
+	}
+    }
+    if ( json ) {
+	output << std::endl << "]" << std::endl;
+    }
+    return output;
+}
+
+
+
 const SolverReport& 
 SolverReport::insertDOMResults() const
 {
@@ -327,6 +467,14 @@ SolverReport::insertDOMResults() const
 	.setResultSolverInformation()
 	.setResultPlatformInformation();
     _delta_time.insertDOMResults( *_document );
+    _document->clearMVAProfile();
+    if ( !__profile.empty() ) {
+	for ( size_t j = 0; j < total._phase.size(); ++j ) {
+	    const PhaseTime& phase = total._phase[j];
+	    if ( phase.count() == 0 ) continue;
+	    _document->addMVAProfile( MVACount::__phase_name[j], phase.count(), phase.total(), phase.mean(), phase.max() );
+	}
+    }
     
     return *this;
 }
@@ -17,6 +17,10 @@
 #ifndef LQNS_SOLVERREPORT_H
 #define	LQNS_SOLVERREPORT_H
 
+#include <array>
+#include <chrono>
+#include <string>
+#include <vector>
 #include <lqio/common_io.h>
 #include <mva/vector.h>
 
@@ -33,12 +37,45 @@ int operator==( const MVACount&, const MVACount& );	// For Vector.cc
 /* ------------------------- Status Reporting. ------------------------ */
 
 
+/*
+ * Wall clock time spent in one phase of solving a submodel.
+ */
+
+class PhaseTime {
+public:
+    PhaseTime() : _n(0), _total(0.0), _max(0.0) {}
+    PhaseTime& operator+=( const double );		/* Add one timing	*/
+    PhaseTime& operator+=( const PhaseTime& );		/* For totalling	*/
+
+    unsigned long count() const { return _n; }
+    double total() const { return _total; }
+    double mean() const { return _n > 0 ? _total / _n : 0.0; }
+    double max() const { return _max; }
+
+private:
+    unsigned long _n;			/* Number of timings.		*/
+    double _total;			/* Seconds.			*/
+    double _max;			/* Seconds.			*/
+};
+
+
 class MVACount {
     friend class SolverReport;
     friend class MVASubmodel;
     friend int operator==( const MVACount& a, const MVACount& b );
 
 public:
+    enum class Phase { BUILD, INTERLOCK, CLOSED, OPEN, SAVE, UPDATE_WAIT };
+    static const std::array<const char *,6> __phase_name;
+
+    class Stopwatch {
+    public:
+	Stopwatch() : _start(std::chrono::steady_clock::now()) {}
+	double elapsed() const { return std::chrono::duration<double>( std::chrono::steady_clock::now() - _start ).count(); }
+    private:
+	const std::chrono::steady_clock::time_point _start;
+    };
+
     static std::ostream& printHeader( std::ostream&, int );
 
 public:
@@ -46,9 +83,13 @@ public:
     MVACount& operator=( const MVACount& );		/* For copying		*/
     MVACount& operator+=( const MVACount& );		/* For totalling	*/
     MVACount& accumulate( const unsigned long, const unsigned long, const unsigned long );	/* For adding to record	*/
+    MVACount& accumulateGroup( const unsigned, const unsigned long );	/* Steps by disjoint group */
     MVACount& start( const unsigned, const unsigned );	/* Start timing		*/
     MVACount& initialize();				/* Reset counters	*/
+    MVACount& time( const Phase phase, const double elapsed ) { _phase[static_cast<size_t>(phase)] += elapsed; return *this; }
+    const PhaseTime& time( const Phase phase ) const { return _phase[static_cast<size_t>(phase)]; }
     std::ostream& print( std::ostream& ) const;
+    std::ostream& printProfile( std::ostream& ) const;
 	
 private:
     unsigned _n;			/* number of times called	*/
@@ -59,6 +100,9 @@ private:
     double wait;			/* wait()'s			*/
     double wait_sqr;			/* wait()'s			*/
     unsigned long faults;		/* MVA failures.		*/
+    unsigned long skipped;		/* Solutions skipped.		*/
+    std::vector<double> group_step;	/* step()'s by disjoint group	*/
+    std::array<PhaseTime,6> _phase;	/* Wall clock time by phase.	*/
 
     LQIO::DOM::CPUTime _start_time;       
     LQIO::DOM::CPUTime _total_time;
@@ -77,8 +121,11 @@ public:
     void start();
     SolverReport& finish( bool valid, const double convergence, unsigned long );
     std::ostream& print( std::ostream& ) const;
+    std::ostream& printProfile( std::ostream&, const std::string& ) const;
     const SolverReport& insertDOMResults() const;
 
+    static std::string __profile;	/* --profile=csv|json		*/
+
     double stepCount() const { return total.step; }
     double waitCount() const { return total.wait; } 
     unsigned long iterations() const { return _iterations; }
@@ -7,14 +7,24 @@
  */
 
 #include "lqns.h"
+#include <algorithm>
 #include <iomanip>
+#include <iostream>
 #include <sstream>
 #include <numeric>
+#include <set>
+#if HAVE_UNISTD_H
+#include <unistd.h>
+#endif
+#if HAVE_SYS_WAIT_H
+#include <sys/wait.h>
+#endif
 #include <lqio/dom_document.h>
 #include <lqx/Program.h>
 #include <lqx/MethodTable.h>
 #include <lqx/Environment.h>
 #include <mva/fpgoop.h>
+#include <mva/mva.h>
 #include "runlqx.h"
 #include "model.h"
 #include "option.h"
@@ -22,10 +32,13 @@
 namespace SolverInterface
 {
 
-    unsigned int Solve::invocationCount = 0;
-    std::string Solve::customSuffix;
-    bool Solve::solveCallViaLQX = false;	/* Flag when a solve() call was made */
-    bool Solve::implicitSolve = false;
+    thread_local unsigned int Solve::invocationCount = 0;
+    thread_local std::string Solve::customSuffix;
+    thread_local bool Solve::solveCallViaLQX = false;	/* Flag when a solve() call was made */
+    thread_local bool Solve::implicitSolve = false;
+    thread_local unsigned int Solve::__workers = 1;
+    thread_local unsigned int Solve::__worker = 0;
+    thread_local FILE * Solve::__marks = nullptr;
 
     LQX::SymbolAutoRef Solve::invoke(LQX::Environment* env, std::vector<LQX::SymbolAutoRef >& args)
     {
@@ -51,6 +64,17 @@ namespace SolverInterface
 	    customSuffix = ss.str();
 	}
 
+	/* When the sweep is shared, mark where the output for this point starts and only solve our points */
+	if ( __workers > 1 && !implicitSolve ) {
+	    FILE * output = env->getDefaultOutput();
+	    fflush( output );
+	    const long offset = ftell( output );
+	    fwrite( &offset, sizeof( offset ), 1, __marks );
+	    if ( (invocationCount - 1) % __workers != __worker ) {
+		return LQX::Symbol::encodeBoolean(true);
+	    }
+	}
+
 #if defined(DEBUG_MESSAGES)
 	env->cleanInvokeGlobalMethod("print_symbol_table", nullptr);
 #endif
@@ -104,4 +128,179 @@ namespace SolverInterface
     }
 
     std::string SolverInterface::Solve::fold( const std::string& s1, const std::string& s2 ) { return s1 + "," + s2; }
+
+
+    /*
+     * Run the program in `workers' child processes.  Every child runs
+     * the whole program, but only solves the points of the sweep for
+     * which (invocation-1) % workers is its number.  The output of the
+     * program is split at each call to solve(), so the output for each
+     * point is taken from the child that solved it and written in the
+     * original order.  Every point starts from reset MVA solvers (see
+     * Submodel::reinitializeSubmodel()) in a sequential run too, so
+     * the output is the same as for a sequential run as long as the
+     * calls to solve() do not depend on the results.  The children
+     * write their console output and errors to files, which the parent
+     * prints once all have finished.
+     *
+     * The points a child skips keep the results of the last point it
+     * solved, or none at all, so a result expression may fail there
+     * (a division by a throughput of zero, say).  The sweep stops
+     * early in a child if a point cannot be solved.  In either case
+     * the output of the children is thrown away and the program is run
+     * again here, in turn.
+     */
+
+    bool Solve::invokeInParallel( LQX::Program * program, FILE * output, unsigned workers )
+    {
+#if HAVE_FORK && HAVE_SYS_WAIT_H
+	LQX::Environment * environment = program->getEnvironment();
+	std::vector<FILE *> outputs;
+	std::vector<FILE *> marks;
+	std::vector<FILE *> consoles;
+	std::vector<FILE *> errors;
+	std::vector<pid_t> pids;
+
+	fflush( nullptr );
+	std::cout.flush();
+	std::cerr.flush();
+	for ( unsigned w = 0; w < workers; ++w ) {
+	    outputs.push_back( tmpfile() );
+	    marks.push_back( tmpfile() );
+	    consoles.push_back( tmpfile() );
+	    errors.push_back( tmpfile() );
+	    if ( outputs.back() == nullptr || marks.back() == nullptr || consoles.back() == nullptr || errors.back() == nullptr ) {
+		throw std::runtime_error( "tmpfile" );
+	    }
+	    const pid_t pid = fork();
+	    if ( pid < 0 ) {
+		throw std::runtime_error( "fork" );
+	    } else if ( pid == 0 ) {
+		MVA::forgetThreadPool();		/* Its threads stayed in the parent */
+		dup2( fileno( consoles.back() ), fileno( stdout ) );
+		dup2( fileno( errors.back() ), fileno( stderr ) );
+		__workers = workers;
+		__worker = w;
+		__marks = marks.back();
+		environment->setDefaultOutput( outputs.back() );
+		const bool ok = program->invoke();
+		std::cout.flush();
+		fflush( nullptr );
+		_exit( (ok ? 0 : 1) | (solveCallViaLQX ? 0 : 2) | (LQIO::io_vars.anError() ? 4 : 0) );
+	    }
+	    pids.push_back( pid );
+	}
+
+	/* Collect the workers, then merge their output. */
+
+	bool ok = true;
+	bool called = true;
+	bool failed = false;
+	for ( std::vector<pid_t>::const_iterator pid = pids.begin(); pid != pids.end(); ++pid ) {
+	    int status = 0;
+	    if ( waitpid( *pid, &status, 0 ) < 0 || !WIFEXITED( status ) ) {
+		ok = false;
+		continue;
+	    }
+	    const int rc = WEXITSTATUS( status );
+	    if ( rc & 1 ) ok = false;
+	    if ( rc & 2 ) called = false;
+	    if ( rc & 4 ) failed = true;
+	}
+	if ( ok ) {
+	    ok = merge( outputs, marks, output != nullptr ? output : stdout );
+	}
+	if ( ok ) {
+	    mergeMessages( consoles, stdout );
+	    mergeMessages( errors, stderr );
+	}
+	std::for_each( outputs.begin(), outputs.end(), &fclose );
+	std::for_each( marks.begin(), marks.end(), &fclose );
+	std::for_each( consoles.begin(), consoles.end(), &fclose );
+	std::for_each( errors.begin(), errors.end(), &fclose );
+	if ( ok ) {
+	    solveCallViaLQX = called;
+	    if ( failed ) LQIO::io_vars.error_count += 1;
+	} else {
+	    if ( Options::Trace::verbose() ) std::cerr << "Solve: the sweep could not be shared, solving it in turn..." << std::endl;
+	    ok = program->invoke();
+	}
+	return ok;
+#else
+	return program->invoke();
+#endif
+    }
+
+
+    /*
+     * Copy the output before the first solve() from worker 0, then the
+     * output following each solve() from the worker that solved it.
+     * All workers must have made the same number of calls; if not,
+     * nothing is written and false is returned.
+     */
+
+    bool Solve::merge( const std::vector<FILE *>& outputs, const std::vector<FILE *>& marks, FILE * output )
+    {
+	const size_t workers = outputs.size();
+	std::vector<std::vector<long>> offsets( workers );
+	for ( size_t w = 0; w < workers; ++w ) {
+	    rewind( marks[w] );
+	    long offset;
+	    while ( fread( &offset, sizeof( offset ), 1, marks[w] ) == 1 ) {
+		offsets[w].push_back( offset );
+	    }
+	    fseek( outputs[w], 0, SEEK_END );
+	    offsets[w].push_back( ftell( outputs[w] ) );		/* End of output */
+	    if ( offsets[w].size() != offsets[0].size() ) {
+		return false;
+	    }
+	}
+
+	const size_t points = offsets[0].size() - 1;
+	char buffer[BUFSIZ];
+	for ( size_t i = 0; i <= points; ++i ) {
+	    const size_t w = i == 0 ? 0 : (i - 1) % workers;
+	    long begin = i == 0 ? 0 : offsets[w][i-1];
+	    const long end = offsets[w][i];
+	    fseek( outputs[w], begin, SEEK_SET );
+	    while ( begin < end ) {
+		const size_t n = fread( buffer, 1, std::min<long>( sizeof( buffer ), end - begin ), outputs[w] );
+		if ( n == 0 ) throw std::runtime_error( "tmpfile" );
+		fwrite( buffer, 1, n, output );
+		begin += n;
+	    }
+	}
+	invocationCount = points;
+	return true;
+    }
+
+
+    /*
+     * Print the console output or errors of the workers on output.
+     * Every worker runs the whole program, so a message which is not
+     * about the points it solved is written by all of them.  Lines
+     * already written by an earlier worker are not printed again.
+     */
+
+    void Solve::mergeMessages( const std::vector<FILE *>& files, FILE * output )
+    {
+	std::set<std::string> printed;
+	char buffer[BUFSIZ];
+	for ( std::vector<FILE *>::const_iterator file = files.begin(); file != files.end(); ++file ) {
+	    std::set<std::string> lines;
+	    std::string line;
+	    rewind( *file );
+	    while ( fgets( buffer, sizeof( buffer ), *file ) != nullptr ) {
+		line += buffer;
+		if ( line.back() != '\n' && !feof( *file ) ) continue;
+		if ( printed.find( line ) == printed.end() ) {
+		    fputs( line.c_str(), output );
+		}
+		lines.insert( line );
+		line.clear();
+	    }
+	    printed.insert( lines.begin(), lines.end() );
+	}
+	fflush( output );
+    }
 }
@@ -9,6 +9,8 @@
 #ifndef _RUNLQX_H
 #define _RUNLQX_H
 
+#include <cstdio>
+#include <vector>
 #include <lqx/Program.h>
 #include <lqx/MethodTable.h>
 #include <lqx/Environment.h>
@@ -33,19 +35,26 @@ namespace SolverInterface {
 	virtual const char* getParameterInfo() const { return "1"; } 
 	virtual std::string getHelp() const { return "Solves the model."; } 
 	virtual LQX::SymbolAutoRef invoke(LQX::Environment* env, std::vector<LQX::SymbolAutoRef >& args);
-	static bool solveCallViaLQX;
-	static bool implicitSolve;
-	static std::string customSuffix;
+	static thread_local bool solveCallViaLQX;
+	static thread_local bool implicitSolve;
+	static thread_local std::string customSuffix;
+
+	static bool invokeInParallel( LQX::Program *, FILE *, unsigned );
 
     private:
 	static std::string fold( const std::string& s1, const std::string& s2 );
+	static bool merge( const std::vector<FILE *>&, const std::vector<FILE *>&, FILE * );
+	static void mergeMessages( const std::vector<FILE *>&, FILE * );
 	
     private:
 	LQIO::DOM::Document* _document;
 	solve_fptr _solve;
 	Model * _model;
 
-	static unsigned int invocationCount;
+	static thread_local unsigned int invocationCount;
+	static thread_local unsigned int __workers;	/* Sweep points are shared by.	*/
+	static thread_local unsigned int __worker;	/* Points solved by this one.	*/
+	static thread_local FILE * __marks;		/* Output offset at each solve.	*/
     };
 }
 #endif 
@@ -55,6 +55,7 @@
 #include <mva/open.h>
 #include <mva/prob.h>
 #include <mva/server.h>
+#include <mva/threadpool.h>
 #include "activity.h"
 #include "call.h"
 #include "entry.h"
@@ -112,15 +113,24 @@ Submodel::initializeSubmodel()
 
 
 /*
- * Initialize server's waiting times and populations.
+ * Initialize server's waiting times and populations.  For a warm
+ * start, the waits on the calls are those of the last solution; only
+ * the phase waits are recomputed for the new parameters.  Otherwise
+ * the MVA solvers are reset too, so the results of a point of a sweep
+ * are the same whichever point was solved before it.
  */
 
 void
-Submodel::reinitializeSubmodel()
+Submodel::reinitializeSubmodel( const bool warm )
 {
     std::for_each( _servers.begin(), _servers.end(), std::mem_fn( &Entity::reinitializeServer ) );
     std::for_each( _clients.begin(), _clients.end(), std::mem_fn( &Task::reinitializeClient ) );
-    std::for_each( _clients.begin(), _clients.end(), [this]( Task * client ){ this->initializeWait( client ); } );
+    if ( warm ) {
+	std::for_each( _clients.begin(), _clients.end(), [this]( Task * client ){ client->updateWait( *this, 1.0 ); } );
+    } else {
+	std::for_each( _clients.begin(), _clients.end(), [this]( Task * client ){ this->initializeWait( client ); } );
+	resetModels();		/* Don't depend on the previous solution */
+    }
     std::for_each( _clients.begin(), _clients.end(), std::mem_fn( &Task::computeThroughputBound ) );
 }
 
@@ -223,6 +233,12 @@ MVASubmodel::MVASubmodel( const unsigned n )
       _openStation(),
       _closedModel(nullptr),
       _openModel(nullptr),
+      _partition(),
+      _anderson(),
+      _mixed(false),
+      _mixing(true),
+      _inputs(),
+      _skip(false),
       _overlapFactor()
 {
 }
@@ -241,6 +257,9 @@ MVASubmodel::~MVASubmodel()
     if ( _closedModel ) {
 	delete _closedModel;
     }
+    for ( auto partition : _partition ) {
+	delete partition;
+    }
     if ( _overlapFactor ) {
 	delete [] _overlapFactor;
     }
@@ -248,6 +267,32 @@ MVASubmodel::~MVASubmodel()
 
 
 
+MVASubmodel::Partition::~Partition()
+{
+    if ( openModel ) {
+	delete openModel;
+    }
+    if ( closedModel ) {
+	delete closedModel;
+    }
+}
+
+
+
+/*
+ * Copy the customers of this group's chains.
+ */
+
+void
+MVASubmodel::Partition::setCustomers( const Population& N )
+{
+    for ( auto k : chains ) {
+	customers[k] = N[k];
+    }
+}
+
+
+
 #if PAN_REPLICATION
 /*
  * Return true if we are using Amy Pan's replication code and replicas are present.
@@ -349,13 +394,26 @@ MVASubmodel::build()
 
     assert ( closedStnNo <= n_stations && openStnNo <= n_stations );
 
-    if ( nOpenStns() > 0 && !flags.no_execute ) {
-	_openModel = new Open( _openStation );
-    }
+    if ( makePartition() ) {
+	for ( auto partition : _partition ) {
+	    if ( partition->openStation.size() > 0 && !flags.no_execute ) {
+		partition->openModel = new Open( partition->openStation );
+	    }
+	    if ( partition->closedStation.size() > 0 ) {
+		const MVA::new_solver solver = solvers.at(Pragma::mva());
+		partition->closedModel = (*solver)( partition->closedStation, partition->customers, _thinkTime, _priority, _overlapFactor );
+	    }
+	}
 
-    if ( n_chains > 0 && nClosedStns() > 0 ) {
-	const MVA::new_solver solver = solvers.at(Pragma::mva());
-	_closedModel = (*solver)( _closedStation, _customers, _thinkTime, _priority, _overlapFactor );
+    } else {
+	if ( nOpenStns() > 0 && !flags.no_execute ) {
+	    _openModel = new Open( _openStation );
+	}
+
+	if ( n_chains > 0 && nClosedStns() > 0 ) {
+	    const MVA::new_solver solver = solvers.at(Pragma::mva());
+	    _closedModel = (*solver)( _closedStation, _customers, _thinkTime, _priority, _overlapFactor );
+	}
     }
 
     std::for_each( _clients.begin(), _clients.end(), [this]( Task * client ){ initializeChains( client ); } );
@@ -371,13 +429,17 @@ MVASubmodel::build()
 
 
 /*
- * Rebuild stations and customers as needed.
+ * Rebuild stations and customers as needed.  Stations whose type has
+ * not changed are kept, along with the solvers and their arrays, so
+ * only the customers need to be reset when parameters alone change.
  */
 
 MVASubmodel&
 MVASubmodel::rebuild()
 {
+    const Population customers( _customers );
     remakeChains();
+    bool changed = customers != _customers;
 
     /* ------------------ Recreate servers for model. -----------------	*/
 
@@ -394,14 +456,23 @@ MVASubmodel::rebuild()
 
 	if ( closedIndex ) {
 	    newStation->closedIndex = closedIndex;
-	    _closedStation[closedIndex] = newStation;		/* ... and in with the new...	*/
+	    *std::find( _closedStation.begin(), _closedStation.end(), oldStation ) = newStation;	/* ... and in with the new...	*/
 	}
 	if ( openIndex ) {
 	    newStation->openIndex = openIndex;
-	    _openStation[openIndex] = newStation;		/* ... and in with the new...	*/
+	    *std::find( _openStation.begin(), _openStation.end(), oldStation ) = newStation;
+	}
+	for ( auto partition : _partition ) {
+	    std::replace( partition->closedStation.begin(), partition->closedStation.end(), oldStation, newStation );
+	    std::replace( partition->openStation.begin(), partition->openStation.end(), oldStation, newStation );
 	}
 
 	delete oldStation;
+	changed = true;
+    }
+    if ( !changed ) return *this;
+    for ( auto partition : _partition ) {
+	partition->setCustomers( _customers );
     }
 
     return *this;
@@ -409,6 +480,58 @@ MVASubmodel::rebuild()
 
 
 
+/*
+ * Split the stations and chains into the disjoint groups of clients
+ * and servers so that each can be solved by its own MVA and Open
+ * solver.  The solvers see all of the chains, but only those of
+ * their own group have customers.  Return false, leaving the
+ * submodel as one group, unless the split-submodels pragma is set, if
+ * there is only one group, or if a server is not visited by any client
+ * (e.g., open arrivals only).
+ */
+
+bool
+MVASubmodel::makePartition()
+{
+    if ( !Pragma::splitSubmodels() ) return false;
+#if PAN_REPLICATION
+    if ( usePanReplication() ) return false;
+#endif
+    if ( nChains() == 0 || flags.no_execute ) return false;
+    const std::vector<submodel_group_t> groups = this->groups();
+    if ( groups.size() <= 1 ) return false;
+    std::set<Entity *> servers;
+    for ( const auto& group : groups ) {
+	servers.insert( group.second.begin(), group.second.end() );
+    }
+    if ( std::any_of( _servers.begin(), _servers.end(), [&]( Entity * server ){ return server->nEntries() > 0 && servers.find( server ) == servers.end(); } ) ) return false;
+
+    for ( const auto& group : groups ) {
+	Partition * partition = new Partition( nChains() );
+	for ( auto client : group.first ) {
+	    const ChainVector& chains = client->clientChains( number() );
+	    partition->chains.insert( partition->chains.end(), chains.begin(), chains.end() );
+	    if ( client->isClosedModelClient() ) {
+		partition->closedStation.push_back( client->clientStation( number() ) );
+	    }
+	}
+	for ( auto server : group.second ) {
+	    if ( server->nEntries() == 0 ) continue;	/* Null server. */
+	    if ( server->isClosedModelServer() ) {
+		partition->closedStation.push_back( server->serverStation() );
+	    }
+	    if ( server->isOpenModelServer() ) {
+		partition->openStation.push_back( server->serverStation() );
+	    }
+	}
+	partition->setCustomers( _customers );
+	_partition.push_back( partition );
+    }
+    return true;
+}
+
+
+
 /*
  * Look for disjoint chains.  This works as-is for the simple case.
  * However, it will fail for fan-in.  So:
@@ -426,15 +549,7 @@ Submodel&
 Submodel::partition()
 {
     if ( _clients.size() <= 1 ) return *this;	/* No operation */
-    std::vector<submodel_group_t> groups;
-    
-    /* Collect all servers for each client */
-    for ( std::set<Task *>::const_iterator client = _clients.begin(); client != _clients.end(); ++client ) {
-	const std::set<Task *>& group = groups.back().first;
-	if ( !groups.empty() && std::find( group.begin(), group.end(), *client ) != group.end() ) continue;	/* already there */
-	groups.resize( groups.size() + 1 );
-	addToGroup( *client, groups.back() );
-    }
+    std::vector<submodel_group_t> groups = this->groups();
 
     /* locate groups which match */
     std::vector<submodel_group_t*> disjoint;
@@ -485,6 +600,25 @@ Submodel::partition()
 
 
 
+/*
+ * Collect all servers for each client, and all clients of those
+ * servers.  The groups found share no clients or servers.
+ */
+
+std::vector<Submodel::submodel_group_t>
+Submodel::groups() const
+{
+    std::vector<submodel_group_t> groups;
+    for ( std::set<Task *>::const_iterator client = _clients.begin(); client != _clients.end(); ++client ) {
+	if ( std::any_of( groups.begin(), groups.end(), [=]( const submodel_group_t& group ){ return group.first.find( *client ) != group.first.end(); } ) ) continue;	/* already there */
+	groups.resize( groups.size() + 1 );
+	addToGroup( *client, groups.back() );
+    }
+    return groups;
+}
+
+
+
 void
 Submodel::addToGroup( Task * task, submodel_group_t& group ) const
 {
@@ -534,8 +668,12 @@ void
 MVASubmodel::setChains( const ChainVector& chain ) const
 {
     const unsigned k1 = chain[1];
+    MVA * closedModel = _closedModel;
+    for ( auto partition : _partition ) {
+	if ( std::find( partition->chains.begin(), partition->chains.end(), k1 ) != partition->chains.end() ) closedModel = partition->closedModel;
+    }
     for ( ChainVector::const_iterator k2 = std::next(chain.begin()); k2 != chain.end(); ++k2 ) {
-	_closedModel->setThreadChain( *k2, k1 );
+	closedModel->setThreadChain( *k2, k1 );
     }
 }
 
@@ -634,7 +772,6 @@ MVASubmodel::remakeChains()
     /* ----- Set think times, customers and chains for this pass. ----- */
 
     for ( std::set<Task *>::const_iterator client = _clients.begin(); client != _clients.end(); ++client ) {
-	const std::set<Entity *> clientsServers = (*client)->getServers( _servers );	/* Get all servers for this client	*/
 	const unsigned threads = (*client)->nThreads();
 
 #if PAN_REPLICATION
@@ -668,6 +805,7 @@ MVASubmodel::remakeChains()
 	     * Task::threadIndex() simpler.
 	     */
 
+	    const std::set<Entity *> clientsServers = (*client)->getServers( _servers );	/* Get all servers for this client	*/
 	    for ( std::set<Entity *>::const_iterator server = clientsServers.begin(); server != clientsServers.end(); ++server ) {
 		for ( unsigned i = 1; i <= threads; ++i ) {
 		    k += 1;
@@ -890,26 +1028,17 @@ MVASubmodel&
 MVASubmodel::solve( long iterations, MVACount& MVAStats, const double relax )
 {
     if ( _servers.empty() ) return *this;
-    if ( Options::Trace::verbose() ) std::cerr << '.';
-    if ( flags.reset_mva ) { _closedModel->reset(); }
 
-    const bool trace = Options::Trace::mva( number() );
-
-    MVAStats.start( nChains(), _servers.size() );
-
-    if ( trace || Options::Debug::variance() ) {
-	std::cout << print_submodel_header( *this, iterations ) << std::endl;
+    initializeStations( iterations, MVAStats );
+    if ( _skip ) {
+	updateWaits( iterations, MVAStats, relax );	/* Relax towards the last solution */
+	return *this;
     }
 
-    /* ----------------- initialize the stations ------------------ */
-
-    std::for_each( _servers.begin(), _servers.end(), std::mem_fn( &Entity::clear ) );	/* Clear visit ratios and what have you */
-    std::for_each( _clients.begin(), _clients.end(), InitializeClientStation( *this ) );
-    std::for_each( _servers.begin(), _servers.end(), InitializeServerStation( *this ) );
-
 #if PAN_REPLICATION
     /* ------------------- Replication Iteration ------------------- */
 
+    const bool trace = Options::Trace::mva( number() );
     double deltaRep	= 0.0;
     unsigned iter       = 0; //REP N-R
 
@@ -932,129 +1061,419 @@ MVASubmodel::solve( long iterations, MVACount& MVAStats, const double relax )
 	}
 #endif
 
-	if ( trace ) {
-	    if ( _openModel != nullptr ) {
-		if ( _closedModel != nullptr ) std::cout << print_trace_header( "Open Model" );
-		printOpenModel( std::cout );
+	traceModels();
+	solveModels( MVAStats );
+	saveResults( iterations, MVAStats, relax );
+
+#if PAN_REPLICATION
+	/* Update waits for replication */
+
+	deltaRep = 0.0;
+	if ( usePanReplication() ) {
+	    unsigned n_deltaRep = 0;
+	    for ( auto client : _clients ) deltaRep += client->updateWaitReplication( *this, n_deltaRep );
+	    if ( n_deltaRep ) {
+		deltaRep = sqrt( deltaRep / n_deltaRep );	/* Take RMS value over all phases */
 	    }
-	    if ( _closedModel != nullptr ) {
-		if ( _openModel != nullptr ) std::cout << print_trace_header( "Closed Model" );
-		printClosedModel( std::cout );
+	    if ( iter >= LQIO::DOM::__document->getModelIterationLimitValue() ) {
+		LQIO::runtime_error( ADV_REPLICATION_ITERATION_LIMIT, number(), iter, deltaRep, LQIO::DOM::__document->getModelConvergenceValue() );
+		deltaRep = 0;		/* Break out of loop */
 	    }
 	}
+#endif
 
-	/* ----------------- Solve the model. ----------------- */
+	updateWaits( iterations, MVAStats, relax );
 
-	if ( _closedModel ) {
+#if PAN_REPLICATION
+    } while ( usePanReplication() && deltaRep > LQIO::DOM::__document->getModelConvergenceValue() );
+
+    /* ----------------End of Replication Iteration --------------- */
+#endif
 
-	    if ( _openModel ) {
+    return *this;
+}
 
-		/* If model has any open classes, convert for closed model. */
 
-		try {
-		    _openModel->convert( _customers );
-		}
-		catch ( const std::range_error& error ) {
-		    MVAStats.faults += 1;
-		    if ( Pragma::stopOnMessageLoss() && std::any_of( _servers.begin(), _servers.end(), std::mem_fn( &Entity::openModelInfinity ) ) ) {
-			throw;
-		    }
+
+/*
+ * True if the layer can be solved in steps by Jacobi layering, i.e.,
+ * if it does not iterate on its own for replication.
+ */
+
+bool
+MVASubmodel::isStaged() const
+{
+#if PAN_REPLICATION
+    if ( usePanReplication() ) return false;
+#endif
+    return !_servers.empty();
+}
+
+
+
+/*
+ * Set up the stations from the current waits and think times.
+ */
+
+void
+MVASubmodel::start( long iterations, MVACount& MVAStats )
+{
+    initializeStations( iterations, MVAStats );
+    traceModels();
+}
+
+
+
+/*
+ * Save the results and compute the new waits of the clients.
+ */
+
+void
+MVASubmodel::finish( long iterations, MVACount& MVAStats, const double relax )
+{
+    if ( !_skip ) {
+	saveResults( iterations, MVAStats, relax );
+    }
+    updateWaits( iterations, MVAStats, relax );
+}
+
+
+
+void
+MVASubmodel::initializeStations( long iterations, MVACount& MVAStats )
+{
+    if ( Options::Trace::verbose() ) std::cerr << '.';
+
+    MVAStats.start( nChains(), _servers.size() );
+
+    if ( Options::Trace::mva( number() ) || Options::Debug::variance() ) {
+	std::cout << print_submodel_header( *this, iterations ) << std::endl;
+    }
+
+    /* ----------------- initialize the stations ------------------ */
+
+    std::for_each( _servers.begin(), _servers.end(), std::mem_fn( &Entity::clear ) );	/* Clear visit ratios and what have you */
+    std::for_each( _clients.begin(), _clients.end(), InitializeClientStation( *this ) );
+    std::for_each( _servers.begin(), _servers.end(), InitializeServerStation( *this ) );
+
+    _skip = !inputsChanged( iterations );
+    if ( _skip ) {
+	MVAStats.skipped += 1;
+    } else if ( flags.reset_mva ) {
+	resetModels();
+    }
+}
+
+
+
+/*
+ * Discard the results that the closed models keep from their last
+ * solution, so that the next solution starts from scratch.
+ */
+
+void
+MVASubmodel::resetModels()
+{
+    if ( _closedModel ) _closedModel->reset();
+    for ( auto partition : _partition ) if ( partition->closedModel ) partition->closedModel->reset();
+}
+
+
+
+/*
+ * With skip-converged, return false if none of the customers,
+ * priorities, think times, overlap factors, service times and visits
+ * set up for the stations have changed at all since the submodel was
+ * last solved, so the last solution can be used again.  Allowing even
+ * the convergence value of slack lets the error build up over the
+ * skipped solutions.  Every submodel is solved on the first
+ * iteration and every skip-converged iterations after that.
+ */
+
+bool
+MVASubmodel::inputsChanged( long iterations )
+{
+    const unsigned int period = Pragma::skipConverged();
+    if ( period == 0 ) return true;
+#if PAN_REPLICATION
+    if ( usePanReplication() ) return true;
+#endif
+
+    std::vector<double> inputs( _thinkTime.begin(), _thinkTime.end() );
+    for ( unsigned k = 1; k <= nChains(); ++k ) {
+	inputs.push_back( _customers[k] );
+	inputs.push_back( _priority[k] );
+	if ( _overlapFactor ) inputs.insert( inputs.end(), _overlapFactor[k].begin(), _overlapFactor[k].end() );
+    }
+    std::set<const Server *> stations( _closedStation.begin(), _closedStation.end() );
+    stations.insert( _openStation.begin(), _openStation.end() );
+    for ( auto station : stations ) {
+	for ( unsigned e = 1; e <= station->nEntries(); ++e ) {
+	    for ( unsigned k = 0; k <= station->nClasses(); ++k ) {
+		for ( unsigned p = 1; p <= station->nPhases(); ++p ) {
+		    inputs.push_back( station->S( e, k, p ) );
+		    inputs.push_back( station->V( e, k, p ) );
+		    if ( station->hasVariance() ) inputs.push_back( station->getVariance( e, k, p ) );
 		}
 	    }
+	}
+    }
+
+    if ( iterations > 1 && iterations % period != 0 && inputs == _inputs ) {
+	return false;
+    }
+    _inputs.swap( inputs );
+    return true;
+}
+
+
+
+void
+MVASubmodel::traceModels()
+{
+    if ( !Options::Trace::mva( number() ) ) return;
+    const bool hasOpenModel = _openModel != nullptr || std::any_of( _partition.begin(), _partition.end(), []( const Partition * partition ){ return partition->openModel != nullptr; } );
+    const bool hasClosedModel = _closedModel != nullptr || std::any_of( _partition.begin(), _partition.end(), []( const Partition * partition ){ return partition->closedModel != nullptr; } );
+    if ( hasOpenModel ) {
+	if ( hasClosedModel ) std::cout << print_trace_header( "Open Model" );
+	printOpenModel( std::cout );
+    }
+    if ( hasClosedModel ) {
+	if ( hasOpenModel ) std::cout << print_trace_header( "Closed Model" );
+	printClosedModel( std::cout );
+    }
+}
 
-	    try {
-		_closedModel->solve();
-	    }
-	    catch ( const std::range_error& error ) {
-		throw;
-	    }
 
-	    /* Statistics by level -- we can use this to find performance bottlenecks */
 
+/*
+ * Solve the open and closed models.  Only the stations of this
+ * submodel are changed, so layers can be solved at the same time.
+ * Disjoint groups of the submodel are solved independently.
+ */
+
+void
+MVASubmodel::solveModels( MVACount& MVAStats )
+{
+    if ( _skip ) return;
+    if ( _partition.empty() ) {
+	double closed = 0.0;
+	double open = 0.0;
+	MVAStats.faults += solveModels( _closedModel, _openModel, _customers, closed, open );
+	if ( _closedModel ) MVAStats.time( MVACount::Phase::CLOSED, closed );
+	if ( _openModel ) MVAStats.time( MVACount::Phase::OPEN, open );
+
+	/* Statistics by level -- we can use this to find performance bottlenecks */
+
+	if ( _closedModel ) {
 	    MVAStats.accumulate( _closedModel->iterations(), _closedModel->waits(), _closedModel->faults() );
 	}
+	return;
+    }
+
+    std::vector<unsigned long> faults( _partition.size(), 0 );
+    std::vector<double> closed( _partition.size(), 0.0 );
+    std::vector<double> open( _partition.size(), 0.0 );
+    const Pragma * cache = Pragma::current();
+    const std::string& file_name = LQIO::DOM::Document::__input_file_name;
+    std::atomic<unsigned> errors( 0 );
+    MVA::threadPool()->run( _partition.size(), [&]( const size_t g, const unsigned ) {
+	    const Pragma::Use use( cache );
+	    const LQIO::DOM::Document::InputFileName name( file_name );
+	    const LQIO::lqio_params_stats::Count count( errors );
+	    faults[g] = solveModels( _partition[g]->closedModel, _partition[g]->openModel, _partition[g]->customers, closed[g], open[g] );
+	} );
+    LQIO::io_vars.error_count += errors;
+
+    unsigned long iterations = 0;
+    unsigned long waits = 0;
+    unsigned long nfaults = 0;
+    for ( unsigned g = 0; g < _partition.size(); ++g ) {
+	const MVA * closedModel = _partition[g]->closedModel;
+	nfaults += faults[g];
+	if ( _partition[g]->openModel ) MVAStats.time( MVACount::Phase::OPEN, open[g] );
+	if ( !closedModel ) continue;
+	MVAStats.time( MVACount::Phase::CLOSED, closed[g] );
+	iterations += closedModel->iterations();
+	waits += closedModel->waits();
+	nfaults += closedModel->faults();
+	MVAStats.accumulateGroup( g + 1, closedModel->iterations() );
+    }
+    MVAStats.accumulate( iterations, waits, nfaults );
+}
+
+
+
+/*
+ * Solve one closed model and its open model.  Returns the number of
+ * failures converting the open classes.  The wall clock time of each
+ * is returned in closed and open.
+ */
+
+unsigned long
+MVASubmodel::solveModels( MVA * closedModel, Open * openModel, const Population& customers, double& closed, double& open ) const
+{
+    unsigned long faults = 0;
+
+    if ( closedModel ) {
+	const MVACount::Stopwatch clock;
+
+	if ( openModel ) {
+
+	    /* If model has any open classes, convert for closed model. */
 
-	if ( _openModel ) {
 	    try {
-		if ( _closedModel ) {
-		    _openModel->solve( *_closedModel, _customers );	/* Calculate L[0] queue lengths. */
-		} else {
-		    _openModel->solve();
-		}
-	    } 
+		openModel->convert( customers );
+	    }
 	    catch ( const std::range_error& error ) {
+		faults += 1;
 		if ( Pragma::stopOnMessageLoss() && std::any_of( _servers.begin(), _servers.end(), std::mem_fn( &Entity::openModelInfinity ) ) ) {
 		    throw;
 		}
 	    }
 	}
 
-	if ( trace ) {
-	    std::ios_base::fmtflags oldFlags = std::cout.setf( std::ios::right, std::ios::adjustfield );
-	    if ( _openModel != nullptr  ) {
-		if ( _closedModel != nullptr ) std::cout << print_trace_header( "Open Model" );
-		std::cout << *_openModel << std::endl << std::endl;
+	try {
+	    closedModel->solve();
+	}
+	catch ( const std::range_error& error ) {
+	    throw;
+	}
+	closed = clock.elapsed();
+    }
+
+    if ( openModel ) {
+	const MVACount::Stopwatch clock;
+	try {
+	    if ( closedModel ) {
+		openModel->solve( *closedModel, customers );	/* Calculate L[0] queue lengths. */
+	    } else {
+		openModel->solve();
 	    }
-	    if ( _closedModel != nullptr ) {
-		if ( _openModel != nullptr ) std::cout << print_trace_header( "Closed Model" );
-		std::cout << *_closedModel << std::endl << std::endl;
+	} 
+	catch ( const std::range_error& error ) {
+	    if ( Pragma::stopOnMessageLoss() && std::any_of( _servers.begin(), _servers.end(), std::mem_fn( &Entity::openModelInfinity ) ) ) {
+		throw;
 	    }
-	    std::cout.flags( oldFlags );
 	}
+	open = clock.elapsed();
+    }
+    return faults;
+}
 
-	/* ---------- Set wait and think times for next pass. --------- */
 
-	if ( flags.trace_throughput || flags.trace_think_time ) {
-	    std::cout <<"MVASubmodel::solve( ) .... completed solving the MVA model......." << std::endl;
-	}
 
-	std::for_each( _clients.begin(), _clients.end(), MVASubmodel::SaveClientResults( *this ) );
-	std::for_each( _servers.begin(), _servers.end(), MVASubmodel::SaveServerResults( *this, relax ) );
-
-	/* --- Compute and save new values for entry service times. --- */
+void
+MVASubmodel::saveResults( long iterations, MVACount& MVAStats, const double relax )
+{
+    const MVACount::Stopwatch clock;
 
-	if ( Options::Trace::delta_wait( number() ) ) {
-	    std::cout << "------ updateWait for submodel " << number() << ", iteration " << iterations << " ------" << std::endl;
+    if ( Options::Trace::mva( number() ) ) {
+	std::ios_base::fmtflags oldFlags = std::cout.setf( std::ios::right, std::ios::adjustfield );
+	if ( _openModel != nullptr  ) {
+	    if ( _closedModel != nullptr ) std::cout << print_trace_header( "Open Model" );
+	    std::cout << *_openModel << std::endl << std::endl;
 	}
-
-#if PAN_REPLICATION
-	/* Update waits for replication */
-
-	deltaRep = 0.0;
-	if ( usePanReplication() ) {
-	    unsigned n_deltaRep = 0;
-	    for ( auto client : _clients ) deltaRep += client->updateWaitReplication( *this, n_deltaRep );
-	    if ( n_deltaRep ) {
-		deltaRep = sqrt( deltaRep / n_deltaRep );	/* Take RMS value over all phases */
+	if ( _closedModel != nullptr ) {
+	    if ( _openModel != nullptr ) std::cout << print_trace_header( "Closed Model" );
+	    std::cout << *_closedModel << std::endl << std::endl;
+	}
+	for ( auto partition : _partition ) {
+	    if ( partition->openModel != nullptr ) {
+		std::cout << print_trace_header( "Open Model" ) << *partition->openModel << std::endl << std::endl;
 	    }
-	    if ( iter >= LQIO::DOM::__document->getModelIterationLimitValue() ) {
-		LQIO::runtime_error( ADV_REPLICATION_ITERATION_LIMIT, number(), iter, deltaRep, LQIO::DOM::__document->getModelConvergenceValue() );
-		deltaRep = 0;		/* Break out of loop */
+	    if ( partition->closedModel != nullptr ) {
+		std::cout << print_trace_header( "Closed Model" ) << *partition->closedModel << std::endl << std::endl;
 	    }
 	}
-#endif
+	printStatistics( std::cout );
+	std::cout.flags( oldFlags );
+    }
+
+    /* ---------- Set wait and think times for next pass. --------- */
+
+    if ( flags.trace_throughput || flags.trace_think_time ) {
+	std::cout <<"MVASubmodel::solve( ) .... completed solving the MVA model......." << std::endl;
+    }
+
+    std::for_each( _clients.begin(), _clients.end(), MVASubmodel::SaveClientResults( *this ) );
+    std::for_each( _servers.begin(), _servers.end(), MVASubmodel::SaveServerResults( *this, relax ) );
+
+    /* --- Compute and save new values for entry service times. --- */
 
-	/* Update waits for everyone else. */
+    if ( Options::Trace::delta_wait( number() ) ) {
+	std::cout << "------ updateWait for submodel " << number() << ", iteration " << iterations << " ------" << std::endl;
+    }
+    MVAStats.time( MVACount::Phase::SAVE, clock.elapsed() );
+}
 
+
+
+void
+MVASubmodel::updateWaits( long iterations, MVACount& MVAStats, const double relax )
+{
+    /* Update waits for everyone else. */
+
+    const MVACount::Stopwatch clock;
+    if ( Pragma::relaxation( Pragma::Relaxation::ANDERSON ) ) {
+	accelerateWaits( iterations, relax );
+    } else {
 	for ( auto client : _clients ) client->updateWait( *this, relax );
+    }
+    MVAStats.time( MVACount::Phase::UPDATE_WAIT, clock.elapsed() );
 
-	if ( !check_fp_ok() ) {
-	    throw floating_point_error( __FILE__, __LINE__ );
-	}
+    if ( !check_fp_ok() ) {
+	throw floating_point_error( __FILE__, __LINE__ );
+    }
 
-	if ( flags.single_step ) {
-	    debug_stop( iterations, 0 );
-	}
+    if ( flags.single_step ) {
+	debug_stop( iterations, 0 );
+    }
+}
 
-#if PAN_REPLICATION
-    } while ( usePanReplication() && deltaRep > LQIO::DOM::__document->getModelConvergenceValue() );
 
-    /* ----------------End of Replication Iteration --------------- */
-#endif
 
-    return *this;
+
+/*
+ * Mix the new waits of the clients with those of the last few
+ * iterations of the layers using Anderson acceleration.  If the mix
+ * can't be used, the new waits are underrelaxed as usual.  Once a mix
+ * that has been used is rejected, the iteration is oscillating about
+ * the solution, so mixing is dropped for the rest of the solve.  The thread
+ * idle times are not mixed; they are recomputed from the waits and
+ * underrelaxed against their values before the update.
+ */
+
+void
+MVASubmodel::accelerateWaits( long iterations, const double relax )
+{
+    if ( iterations <= 1 ) {
+	_anderson.reset( Anderson::default_depth );
+	_mixed = false;
+	_mixing = true;
+    }
+
+    std::vector<double> x;
+    std::vector<double> z;
+    for ( auto client : _clients ) client->getWaits( *this, x );
+    for ( auto client : _clients ) client->getThinkTimes( z );
+    for ( auto client : _clients ) client->updateWait( *this, 1.0 );
+    std::vector<double> g;
+    for ( auto client : _clients ) client->getWaits( *this, g );
+
+    if ( _mixing && _anderson.mix( x, g ) ) {
+	_mixed = true;
+    } else {
+	_mixing = !_mixed;
+	for ( size_t i = 0; i < g.size(); ++i ) g[i] = under_relax( x[i], g[i], relax );
+    }
+
+    std::vector<double>::const_iterator waits = g.begin();
+    for ( auto client : _clients ) client->setWaits( *this, waits );
+    std::vector<double>::const_iterator think_times = z.begin();
+    for ( auto client : _clients ) client->setThinkTimes( think_times, relax );
 }
-
+
 /* ----------------------------- Save Results ----------------------------- */
 
 
@@ -1120,22 +1539,47 @@ MVASubmodel::SaveServerResults::operator()( Entity * server ) const
     /*- BUG_433 */
 }
 
+/*
+ * Return the solvers for station.  The station indices are those of
+ * the group's solvers when the submodel is partitioned.
+ */
+
+const MVA *
+MVASubmodel::closedModel( const Server& station ) const
+{
+    for ( auto partition : _partition ) {
+	const unsigned m = station.closedIndex;
+	if ( 0 < m && m <= partition->closedStation.size() && partition->closedStation[m] == &station ) return partition->closedModel;
+    }
+    return _closedModel;
+}
+
+const Open *
+MVASubmodel::openModel( const Server& station ) const
+{
+    for ( auto partition : _partition ) {
+	const unsigned m = station.openIndex;
+	if ( 0 < m && m <= partition->openStation.size() && partition->openStation[m] == &station ) return partition->openModel;
+    }
+    return _openModel;
+}
+
 double
 MVASubmodel::openModelThroughput( const Server& station, unsigned int e ) const
 {
-    return _openModel != nullptr ? _openModel->entryThroughput( station, e ) : 0.0;
+    return openModel( station ) != nullptr ? openModel( station )->entryThroughput( station, e ) : 0.0;
 }
 
 double
 MVASubmodel::closedModelThroughput( const Server& station, unsigned int e ) const
 {
-    return _closedModel != nullptr ? _closedModel->entryThroughput( station, e ) : 0.0;
+    return closedModel( station ) != nullptr ? closedModel( station )->entryThroughput( station, e ) : 0.0;
 }
 
 double
 MVASubmodel::closedModelThroughput( const Server& station, unsigned int e, unsigned int k ) const
 {
-    return _closedModel != nullptr ? _closedModel->throughput( station, e, k ) : 0.0;
+    return closedModel( station ) != nullptr ? closedModel( station )->throughput( station, e, k ) : 0.0;
 }
 
 #if PAN_REPLICATION
@@ -1149,20 +1593,20 @@ MVASubmodel::closedModelNormalizedThroughput( const Server& station, unsigned in
 double
 MVASubmodel::closedModelUtilization( const Server& station ) const
 {
-    return _closedModel != nullptr ? _closedModel->utilization( station ) : 0.0;
+    return closedModel( station ) != nullptr ? closedModel( station )->utilization( station ) : 0.0;
 }
 
 double
 MVASubmodel::openModelUtilization( const Server& station ) const
 {
-    return _openModel != nullptr ? _openModel->utilization( station ) : 0.0;
+    return openModel( station ) != nullptr ? openModel( station )->utilization( station ) : 0.0;
 }
 
 #if BUG_393
 double
 MVASubmodel::closedModelMarginalQueueProbability( const Server& station, unsigned int i ) const
 {
-    return _closedModel != nullptr ? static_cast<double>(_closedModel->marginalQueueProbability( station, i ) ) : 0.0;
+    return closedModel( station ) != nullptr ? static_cast<double>(closedModel( station )->marginalQueueProbability( station, i ) ) : 0.0;
 }
 #endif
 
@@ -1270,6 +1714,28 @@ MVASubmodel::printClosedModel( std::ostream& output ) const
 
 
 
+/*
+ * Print the statistics kept by the stations of the closed model, such
+ * as the use of the Conway population tables.  Stations are numbered
+ * as in printClosedModel().
+ */
+
+std::ostream&
+MVASubmodel::printStatistics( std::ostream& output ) const
+{
+    unsigned stnNo = 1 + std::count_if( _clients.begin(), _clients.end(), std::mem_fn( &Task::isClosedModelClient ) );
+
+    for ( std::set<Entity *>::const_iterator server = _servers.begin(); server != _servers.end(); ++server ) {
+	if ( (*server)->isClosedModelServer() ) {
+	    (*server)->serverStation()->printStatistics( output, stnNo );
+	    stnNo += 1;
+	}
+    }
+    return output;
+}
+
+
+
 /*
  * Print stations of open model.
  */
@@ -15,6 +15,8 @@
 
 
 #include <set>
+#include <vector>
+#include <mva/anderson.h>
 #include <mva/vector.h>
 #include <mva/pop.h>
 
@@ -100,11 +102,12 @@ public:
 
     Submodel& addClients();
     void initializeSubmodel();
-    void reinitializeSubmodel();
+    void reinitializeSubmodel( bool );
     virtual void initializeInterlock() {}
     virtual Submodel& build() { return *this; }
     virtual Submodel& rebuild() { return *this; }
     virtual Submodel& partition();
+    virtual void resetModels() {}
 
 
 #if PAN_REPLICATION
@@ -116,6 +119,16 @@ public:
 
     virtual Submodel& solve( long, MVACount&, const double ) = 0;
 
+    /*
+     * solve() in three steps for Jacobi layering.  start() and finish()
+     * are called in submodel order; solveModels() may run at the same
+     * time as that of other submodels.
+     */
+    virtual bool isStaged() const { return false; }
+    virtual void start( long, MVACount& ) {}
+    virtual void solveModels( MVACount& ) {}
+    virtual void finish( long, MVACount&, const double ) {}
+
     virtual std::ostream& print( std::ostream& ) const = 0;
 
     void debug_stop( const unsigned long, const double ) const;
@@ -124,6 +137,7 @@ protected:
     void setNChains( unsigned int n ) { _n_chains = n; }
     SubmodelManip print_submodel_header( const Submodel& aSubModel, const unsigned long iterations  ) { return SubmodelManip( &Submodel::submodel_header_str, aSubModel, iterations ); }
     SubmodelTraceManip print_trace_header( const std::string& str ) { return SubmodelTraceManip( &Submodel::submodel_trace_header_str, str ); }
+    std::vector<submodel_group_t> groups() const;
 
 private:
     void initializeWait( Task * ) const;
@@ -204,6 +218,25 @@ class MVASubmodel : public Submodel {
 	const double _relaxation;
     };
 
+    /*
+     * Clients and the servers that no other client of the submodel
+     * visits, solved by their own closed and open model.  The chains
+     * of the other groups have no customers.
+     */
+
+    struct Partition {
+	Partition( const unsigned n_chains ) : chains(), customers(n_chains), closedStation(), openStation(), closedModel(nullptr), openModel(nullptr) {}
+	~Partition();
+	void setCustomers( const Population& );
+	
+	std::vector<unsigned> chains;	/* Chains (k) of the group	*/
+	Population customers;		/* Customers by chain k		*/
+	Vector<Server *> closedStation;
+	Vector<Server *> openStation;
+	MVA * closedModel;
+	Open * openModel;
+    };
+
     struct PrintServer {
 	PrintServer( std::ostream& output, bool (Entity::*predicate)() const ) : _output(output), _predicate(predicate) {}
 	void operator()( const Entity * ) const;
@@ -222,6 +255,7 @@ public:
     virtual void initializeInterlock();
     virtual MVASubmodel& build();
     virtual MVASubmodel& rebuild();
+    virtual void resetModels();
 		
     unsigned customers( const unsigned k ) const { return _customers[k]; }
     double thinkTime( const unsigned k ) const { return _thinkTime[k]; }
@@ -238,6 +272,10 @@ public:
 #endif
 
     virtual MVASubmodel& solve( long, MVACount&, const double );
+    virtual bool isStaged() const;
+    virtual void start( long, MVACount& );
+    virtual void solveModels( MVACount& );
+    virtual void finish( long, MVACount&, const double );
 	
     double openModelThroughput( const Server& station, unsigned int e ) const;
     double closedModelThroughput( const Server& station, unsigned int e ) const;
@@ -260,6 +298,16 @@ private:
     bool hasReplicas() const { return _hasReplicas; }
 
     void initializeChains( Task* client ) const;
+    bool makePartition();
+    const MVA * closedModel( const Server& ) const;
+    const Open * openModel( const Server& ) const;
+    void initializeStations( long, MVACount& );
+    bool inputsChanged( long );
+    void traceModels();
+    unsigned long solveModels( MVA *, Open *, const Population&, double&, double& ) const;
+    void saveResults( long, MVACount&, const double );
+    void updateWaits( long, MVACount&, const double );
+    void accelerateWaits( long, const double );
 
 public:
 #if PAN_REPLICATION
@@ -274,6 +322,7 @@ protected:
 
     std::ostream& printClosedModel( std::ostream& ) const;
     std::ostream& printOpenModel( std::ostream& ) const;
+    std::ostream& printStatistics( std::ostream& ) const;
 
 private:
     bool _hasThreads;			/* True if client has forks.	*/
@@ -290,6 +339,12 @@ private:
     Vector<Server *> _openStation;
     MVA * _closedModel;
     Open * _openModel;
+    std::vector<Partition *> _partition;	/* Disjoint groups, if more than one */
+    Anderson _anderson;			/* Client waits, by iteration	*/
+    bool _mixed;			/* An Anderson mix was used	*/
+    bool _mixing;			/* Anderson mix still in use	*/
+    std::vector<double> _inputs;	/* Station inputs at last solve	*/
+    bool _skip;				/* Inputs unchanged, don't solve */
 
     /* Fork-Join stuff. */
 	
@@ -464,10 +464,10 @@ Task::setSurrogateDelaySize( size_t n_chains )
  */
 
 Task&
-Task::createInterlock()
+Task::createInterlock( Interlock::Flow& flow )
 {
     if ( !Pragma::interlock() ) return *this;
-    std::for_each ( entries().begin(), entries().end(), std::mem_fn( &Entry::createInterlock ) );
+    std::for_each ( entries().begin(), entries().end(), [&]( Entry * entry ){ entry->createInterlock( flow ); } );
     return *this;
 }
 
@@ -928,6 +928,68 @@ Task::updateWait( const Submodel& submodel, const double relax )
 
 
 
+/*
+ * Append the waits of my activities and then my entries for the
+ * submodel to waits.
+ */
+
+std::vector<double>&
+Task::getWaits( const Submodel& submodel, std::vector<double>& waits ) const
+{
+    const unsigned n = submodel.number();
+    for ( auto activity : activities() ) waits.push_back( activity->getWaitTime( n ) );
+    for ( auto entry : entries() ) entry->getWaits( submodel, waits );
+    return waits;
+}
+
+
+
+/*
+ * Set the waits found by getWaits() and recompute the entry waits from
+ * them.  The thread idle times are recomputed by setThinkTimes().
+ */
+
+Task&
+Task::setWaits( const Submodel& submodel, std::vector<double>::const_iterator& waits )
+{
+    const unsigned n = submodel.number();
+    for ( auto activity : activities() ) activity->setWaitTime( n, *waits++ );
+    for ( auto entry : entries() ) entry->setWaits( submodel, waits );
+    return *this;
+}
+
+
+
+/*
+ * Append the idle times of my threads (other than the main one) to
+ * think_times.
+ */
+
+std::vector<double>&
+Task::getThinkTimes( std::vector<double>& think_times ) const
+{
+    for ( Vector<Thread *>::const_iterator thread = std::next(threads().begin()); thread != threads().end(); ++thread ) think_times.push_back( (*thread)->thinkTime() );
+    return think_times;
+}
+
+
+
+/*
+ * Restore the idle times saved by getThinkTimes(), then recompute them
+ * from the current waits, under-relaxed by relax.
+ */
+
+Task&
+Task::setThinkTimes( std::vector<double>::const_iterator& think_times, const double relax )
+{
+    for ( Vector<Thread *>::const_iterator thread = std::next(threads().begin()); thread != threads().end(); ++thread ) {
+	(*thread)->setThinkTime( *think_times++ ).setSubmodelThinkTime( relax );
+    }
+    return *this;
+}
+
+
+
 #if PAN_REPLICATION
 /*
  * Compute change in waiting times for this task.
@@ -108,7 +108,7 @@ public:
     virtual void reinitializeClient();
     Task& initCustomers( std::deque<const Task *>& stack, unsigned int customers );
     void initializeWait( const Submodel& submodel );
-    Task& createInterlock();
+    Task& createInterlock( Interlock::Flow& );
     virtual Task& initThreads();
 
     void findParents();
@@ -185,6 +185,10 @@ public:
 #if PAN_REPLICATION
     virtual double updateWaitReplication( const Submodel&, unsigned& );
 #endif
+    std::vector<double>& getWaits( const Submodel&, std::vector<double>& ) const;
+    Task& setWaits( const Submodel&, std::vector<double>::const_iterator& );
+    std::vector<double>& getThinkTimes( std::vector<double>& ) const;
+    Task& setThinkTimes( std::vector<double>::const_iterator&, const double );
 
     /* Threads */
 
@@ -38,15 +38,15 @@ Activity * junk_activity_list = nullptr;
 
 static void activity_cycle_error( std::deque<Activity *>& activity_stack );
 
-static double gamma_dist( const double a, const double b );
-static double erlang_dist( const double a, const int m );
-/* Distribution computation functions.  All take scale and shape, though shape may be ignored. */
-static double rv_constant( const double mean, const double shape );
-static double rv_gamma( const double mean, const double shape );
-static double rv_exponential( const double mean, const double shape );
-static double rv_pareto( const double scale, const double shape );
-static double rv_uniform( const double scale, const double shape );
-static double rv_hyperexponential( const double a, const double b);
+static double gamma_dist( Random&, const double a, const double b );
+static double erlang_dist( Random&, const double a, const int m );
+/* Distribution computation functions.  All take the stream, scale and shape, though shape may be ignored. */
+static double rv_constant( Random&, const double mean, const double shape );
+static double rv_gamma( Random&, const double mean, const double shape );
+static double rv_exponential( Random&, const double mean, const double shape );
+static double rv_pareto( Random&, const double scale, const double shape );
+static double rv_uniform( Random&, const double scale, const double shape );
+static double rv_hyperexponential( Random&, const double a, const double b);
 
 std::map<LQIO::DOM::ActivityList*, LQIO::DOM::ActivityList*> Activity::actConnections;
 std::map<LQIO::DOM::ActivityList*, ActivityList *> Activity::domToNative;
@@ -142,6 +142,7 @@ Activity::configure()
     
     _active = 0;
     _cpu_active = 0;
+    _random.set_stream( (_task ? _task->name() : std::string("")) + "/" + name() + "/" + std::to_string( _phase ) );
 
     if ( _dom ) {
 	try { 
@@ -882,7 +883,7 @@ activity_cycle_error( std::deque<Activity *>& activity_stack )
  */
 
 static double
-gamma_dist ( const double a, const double b )
+gamma_dist ( Random& random, const double a, const double b )
 {
 
     if ( b <= 0.0 ) {
@@ -895,15 +896,15 @@ gamma_dist ( const double a, const double b )
 	double x;
 	double y;
 	do {
-	    x = pow( drand48(), 1.0 / b );
-	    y = pow( drand48(), 1.0 / (1.0 - b) );
+	    x = pow( random.uniform(), 1.0 / b );
+	    y = pow( random.uniform(), 1.0 / (1.0 - b) );
 	} while ( x + y > 1.0 );
-	return a * x / ( x + y ) * ps_exponential( 1.0 );
+	return a * x / ( x + y ) * random.exponential( 1.0 );
     } else {
 	double diff = b - floor( b );
-	double temp = erlang_dist( a, (int)b );
+	double temp = erlang_dist( random, a, (int)b );
 	if ( diff > 1.0e-5 ) {
-	    temp += gamma_dist( a, diff );
+	    temp += gamma_dist( random, a, diff );
 	}
 	return temp;
     }
@@ -916,14 +917,14 @@ gamma_dist ( const double a, const double b )
  */
 
 static double
-erlang_dist( const double a, const int m )
+erlang_dist( Random& random, const double a, const int m )
 {
     double	prod;
     int	i;
 
     prod = 1.0;
     for( i = 0; i < m; i++ ) {
-	prod *= drand48();
+	prod *= random.uniform();
     }
     return -a * log(prod);
 }
@@ -935,7 +936,7 @@ erlang_dist( const double a, const int m )
  */
 
 static double
-rv_constant( const double scale, const double shape )
+rv_constant( Random&, const double scale, const double shape )
 {
     return scale;
 }
@@ -945,9 +946,9 @@ rv_constant( const double scale, const double shape )
  */
 
 static double
-rv_uniform( const double scale, const double shape )
+rv_uniform( Random& random, const double scale, const double shape )
 {
-    return scale * drand48();
+    return scale * random.uniform();
 }
 
 /*
@@ -955,9 +956,9 @@ rv_uniform( const double scale, const double shape )
  */
 
 static double
-rv_gamma( const double scale, const double shape )
+rv_gamma( Random& random, const double scale, const double shape )
 {
-    return gamma_dist( scale, shape );;
+    return gamma_dist( random, scale, shape );
 }
 
 
@@ -966,9 +967,9 @@ rv_gamma( const double scale, const double shape )
  */
 
 static double
-rv_exponential( const double scale, const double shape )
+rv_exponential( Random& random, const double scale, const double shape )
 {
-    return ps_exponential( scale );		/* This is macro in parasol */
+    return random.exponential( scale );
 }
 
 
@@ -977,18 +978,18 @@ rv_exponential( const double scale, const double shape )
  */
 
 static double
-rv_hyperexponential( const double mean, const double cv_sqr )
+rv_hyperexponential( Random& random, const double mean, const double cv_sqr )
 {
 #if 0
-    if ( drand48() <= 0.5 / (cv_sqr - 0.5) ) {
-	return ps_exponential( mean * cv_sqr );
+    if ( random.uniform() <= 0.5 / (cv_sqr - 0.5) ) {
+	return random.exponential( mean * cv_sqr );
     } else {
-	return ps_exponential( mean / 2.0 );
+	return random.exponential( mean / 2.0 );
     }
 #else
     const double prob = 0.5 * (1.0 - (std::sqrt((cv_sqr-1.0)/(cv_sqr+1.0))));
-    const double temp = (drand48()>prob) ? (mean/(1.0-prob)) : (mean/prob);
-    return -0.5 * temp * log(drand48());
+    const double temp = (random.uniform()>prob) ? (mean/(1.0-prob)) : (mean/prob);
+    return 0.5 * random.exponential( temp );
 #endif
 }
 
@@ -998,7 +999,7 @@ rv_hyperexponential( const double mean, const double cv_sqr )
  */
 
 static double
-rv_pareto( const double scale, const double shape )
+rv_pareto( Random& random, const double scale, const double shape )
 {
-    return scale * pow( 1.0 - drand48(), -1.0 / shape );
+    return scale * pow( random.uniform(), -1.0 / shape );
 }
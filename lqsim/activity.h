@@ -22,13 +22,14 @@
 #include <lqio/dom_activity.h>
 #include "actlist.h"
 #include "histogram.h"
+#include "random.h"
 #include "target.h"
 #include "result.h"
 
 class Task;
 class Entry;
 
-typedef double (*distribution_func_ptr)( double, double );
+typedef double (*distribution_func_ptr)( Random&, double, double );
 
 class Activity {
     friend class Instance;
@@ -64,7 +65,8 @@ public:
     bool has_lost_messages() const;
     
     void set_arrival_rate( const double r ) { _arrival_rate = r; }
-    double get_slice_time() { return (*_distribution)( _scale, _shape ); }
+    double get_slice_time() { return (*_distribution)( _random, _scale, _shape ); }
+    Random& random() { return _random; }
     Activity& set_DOM( LQIO::DOM::Phase* phaseInfo );
     LQIO::DOM::Phase* getDOM() const { return _dom; }
     const std::vector<LQIO::DOM::Call*>& get_calls() const { return _dom->getCalls(); }
@@ -121,6 +123,7 @@ private:
     double _scale;			/* "scale" for slice distrib.	*/
     double _shape;			/* "shape" for slice distrib.	*/
     distribution_func_ptr _distribution;
+    Random _random;			/* Service, think time, branches*/
     const unsigned int _index;		/* My index (for joins.)	*/
     double _prewaiting;			/* Used for calculating the task waiting time variance only. Tao*/ 
     std::vector<const Entry *> _reply;	/* reply list.			*/
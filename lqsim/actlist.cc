@@ -550,7 +550,7 @@ ActivityList::shuffle()
 {
     const size_t n = _list.size();
     for ( size_t i = n; i >= 1; --i ) {
-	size_t k = static_cast<size_t>(drand48() * i);
+	size_t k = _random.choice( i );
 	if ( i-1 != k ) {
 	    std::swap( _list[k], _list[i-1] );
 	}
@@ -18,6 +18,7 @@
 #define ACTLIST_H
 
 #include <set>
+#include "random.h"
 #include "result.h"
 
 class Entry;
@@ -95,10 +96,12 @@ public:
     virtual ActivityList& push_back( Activity * activity ) { _list.push_back( activity ); return *this; }
     virtual double collect( std::deque<Activity *>& activity_stack, ActivityList::Collect& data ) const = 0;
     void shuffle();
+    Random& random() { return _random; }
 
 private:
     const Type _type;
     LQIO::DOM::ActivityList* _dom;
+    Random _random;			/* Branch choice and shuffle.	*/
 
 protected:
     std::vector<Activity *> _list;		/* Array of activities.		*/
@@ -104,7 +104,7 @@ void
 Instance::client_cycle( const double think_time )
 {
     if ( think_time > 0.0 ) {
-	const double delay = ps_exponential( think_time );
+	const double delay = _cp->random().exponential( think_time );
 	ps_my_schedule_time = ps_now + delay;
 	ps_sleep( delay );
     }
@@ -113,7 +113,7 @@ Instance::client_cycle( const double think_time )
     if ( _cp->n_entries() == 1 ) {
 	server_cycle( _cp->_entry[0], 0, think_time == 0. );
     } else {
-	server_cycle( _cp->_entry[ps_choice( _cp->n_entries() )], 0, think_time == 0. );
+	server_cycle( _cp->_entry[_cp->random().choice( _cp->n_entries() )], 0, think_time == 0. );
     }
 }
 
@@ -1207,7 +1207,7 @@ Instance::do_forwarding ( Message * msg, const Entry * ep )
 	const Targets& fwd = ep->_fwd;	/* forwarding pointer	*/
 	unsigned int i = 0;		/* loop index		*/
 	unsigned int j = 0;		/* loop index (det ph.)	*/
-	tar_t * tp = fwd.entry_to_send_to( i, j );
+	tar_t * tp = fwd.entry_to_send_to( i, j, _cp->random() );
 
 	if ( !tp ) {
 
@@ -1238,11 +1238,11 @@ Instance::do_forwarding ( Message * msg, const Entry * ep )
  */
 
 void
-Instance::random_shuffle_reply( std::vector<const Entry *>& array )
+Instance::random_shuffle_reply( std::vector<const Entry *>& array, Random& random )
 {
     const size_t n = array.size();
     for ( size_t i = n; i >= 1; --i ) {
-	const size_t k = static_cast<size_t>(drand48() * i);
+	const size_t k = random.choice( i );
 	if ( i-1 != k ) {
 	    const Entry * temp = array[k];
 	    array[k] = array[i-1];
@@ -1295,7 +1295,7 @@ Instance::execute_activity( Entry * ep, Activity * ap, bool& reschedule )
      */
 
     if ( ap->think_time() > 0.0 ) {
-	double think_time = ps_exponential( ap->think_time() );
+	double think_time = ap->random().exponential( ap->think_time() );
 	ps_my_schedule_time = ps_now + think_time;
 	ps_sleep( think_time );
     } 
@@ -1330,7 +1330,7 @@ Instance::execute_activity( Entry * ep, Activity * ap, bool& reschedule )
 
 	    compute( ap, phase );
 	    slices += 1.0;
-	    tar_t * tp = ap->_calls.entry_to_send_to( i, j );
+	    tar_t * tp = ap->_calls.entry_to_send_to( i, j, ap->random() );
 
 	    if ( !tp ) break;
 
@@ -1383,7 +1383,7 @@ Instance::execute_activity( Entry * ep, Activity * ap, bool& reschedule )
 
 	/* Reply to all possible */
 
- 	random_shuffle_reply( ap->_reply );
+ 	random_shuffle_reply( ap->_reply, ap->random() );
 	for ( unsigned int i = 0; i < size; ++i ) {
 	    const Entry * reply_ep = ap->_reply[i];
 	    assert( reply_ep->index() < _cp->n_entries() );
@@ -1567,7 +1567,7 @@ again_1:
 	} else if ( fork_list->get_type() == ActivityList::Type::OR_FORK_LIST ) {
 
 	    assert ( fork_list->size() > 0 );
-	    const double exit_value = ps_random;
+	    const double exit_value = fork_list->random().uniform();
 	    double sum = 0.0;
 	    size_t i = 0;
 	    for ( i = 0; i < fork_list->size(); ++i ) {
@@ -1586,7 +1586,7 @@ again_1:
 	again_2:
 	    LoopActivityList * loop_list = dynamic_cast<LoopActivityList *>(fork_list);
 	    ps_my_end_compute_time = ps_now;	/* BUG 321 */
-	    const double exit_value = ps_random * (loop_list->get_total() + 1.0);
+	    const double exit_value = loop_list->random().uniform() * (loop_list->get_total() + 1.0);
 	    double sum = 0;
 	    for ( ActivityList::const_iterator i  = loop_list->begin(); i < loop_list->end(); ++i ) {
 		sum += loop_list->get_count_at(i-loop_list->begin());
@@ -36,7 +36,7 @@ private:
 
 protected:
     static void start( void * );
-    static void random_shuffle_reply( std::vector<const Entry *>& array );
+    static void random_shuffle_reply( std::vector<const Entry *>& array, Random& random );
     static void random_shuffle_activity( std::vector<Activity *>& array );
 
 protected:
@@ -134,6 +134,8 @@ static const struct option longopts[] =
     { "no-warnings",      no_argument,	     0, 'w' },
     { "xml",		  no_argument,	     0, 'x' },
     { "print-interval",   optional_argument, 0, 256+'p' },
+    { "replications",	  required_argument, 0, 256+'n' },
+    { "jobs",		  required_argument, 0, 256+'J' },
     { "global-delay",	  required_argument, 0, 256+'z' },
     { "no-stop-on-message-loss", no_argument,0, 256+'o' },
     { "reload-lqx",	  no_argument,       0, 256+'r' },
@@ -181,6 +183,8 @@ static const std::map<const std::string,const std::string> opthelp  = {
     { "trace-output",	    "Send output from tracing to ARG." },
     { "xml",		    "Output results in XML format." },
     { "print-interval",	    "Ouptut results after n iterations." },
+    { "replications",	    "Run <n> independent replications of the simulation and combine their results." },
+    { "jobs",		    "Run up to <n> replications at the same time." },
     { "global-delay",	    "Set the inter-processor communication delay to n.n." },
     { "no-stop-on-message-loss",      "Do not stop the simulator if asynchronous messages are lost due to queue overfull." },
     { "reload-lqx",	    "Run the LQX program, but re-use the results from a previous invocation." },
@@ -516,6 +520,20 @@ main( int argc, char * argv[] )
 		Model::__enable_print_interval = true;
 		break;
 				
+	    case 256+'n':
+		Model::__replications = strtoul( optarg, &value, 10 );
+		if ( Model::__replications == 0 || *value != '\0' ) {
+		    throw std::invalid_argument( optarg );
+		}
+		break;
+
+	    case 256+'J':
+		Model::__jobs = strtoul( optarg, &value, 10 );
+		if ( Model::__jobs == 0 || *value != '\0' ) {
+		    throw std::invalid_argument( optarg );
+		}
+		break;
+
 	    case 'r':
 		rtf_flag = true;
 		break;
@@ -713,6 +731,8 @@ usage(void)
 	    case 'S': s += "=<n>"; break;
 	    case 't': s += "=<trace>"; break;
 	    case 'T': s += "=<n>"; break;
+	    case 256+'n':
+	    case 256+'J': s += "=<n>"; break;
 	    }
 	} else {
 	    s = " ";
@@ -24,7 +24,7 @@ class tar_t;
 
 class Message {
 public:
-    Message( const Entry * e=nullptr, tar_t  * tp=nullptr ) { init( e, tp ); }
+    Message( const Entry * e=nullptr, tar_t  * tp=nullptr ) : next(nullptr) { init( e, tp ); }
     Message * init( const Entry * e, tar_t * tp );
     
     Activity * activity;		/* Activity to run.		*/
@@ -33,6 +33,7 @@ public:
     int reply_port;			/* Place to send reply.		*/
     const Entry * intermediate;		/* Pointer to intermediate entry*/
     tar_t * target;			/* Index of appropriate stat.	*/
+    Message * next;			/* Task's free message list.	*/
 };
 
 #endif
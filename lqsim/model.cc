@@ -13,21 +13,25 @@
  */
 
 #include "lqsim.h"
+#include <algorithm>
 #include <cassert>
 #include <cmath>
 #include <cstdarg>
+#include <cstdint>
 #include <cstdlib>
 #include <fstream>
 #include <functional>
 #include <numeric>
 #include <sstream>
 #include <errno.h>
+#include <signal.h>
 #include <unistd.h>
 #if HAVE_SYS_UTSNAME_H
 #include <sys/utsname.h>
 #endif
 #include <sys/stat.h>
 #if HAVE_SYS_WAIT_H
+#include <sys/wait.h>
 #endif
 #if HAVE_MCHECK_H
 #include <mcheck.h>
@@ -51,6 +55,7 @@
 #include "model.h"
 #include "pragma.h"
 #include "processor.h"
+#include "random.h"
 #include "runlqx.h"		// Coupling here is ugly at the moment
 #include "task.h"
 
@@ -62,6 +67,8 @@ int Model::__genesis_task_id = 0;
 Model * Model::__model = nullptr;
 bool Model::__enable_print_interval = false;
 unsigned int Model::__print_interval = 0;
+unsigned int Model::__replications = 1;
+unsigned int Model::__jobs = 1;
 double Model::max_service = 0.0;
 const double Model::simulation_parameters::DEFAULT_TIME = 1e5;
 bool deferred_exception = false;	/* domain error detected during run.. throw after parasol stops. */
@@ -455,6 +462,15 @@ Model::print_raw_stats( FILE * output ) const
 	(*processor)->r_util.print_raw( output, "Processor %-11.11s - Utilization", (*processor)->name().c_str() );
     }
 
+    if ( std::any_of( Task::__tasks.begin(), Task::__tasks.end(), []( const Task * task ){ return task->msg_pool_size() > 0; } ) ) {
+	(void) fprintf( output, "\n%.*s Message Pool Information %.*s\n",
+			(((number_blocks > 2) ? long_width : short_width) - 26) / 2, dashes,
+			(((number_blocks > 2) ? long_width : short_width) - 26) / 2, dashes );
+	(void) fprintf( output, "%-34s%8s %8s %12s\n", "Name", "Size", "Peak", "Allocs" );
+	std::for_each( Task::__tasks.begin(), Task::__tasks.end(), [=]( const Task * task ){ task->print_msg_pool( output ); } );
+    }
+    ps_slab_stats( output );
+
 #ifdef	NOTDEF
     if ( ps_used_links ) {
 	(void) fprintf( output, "\n%.*s Link Information %*.s\n",
@@ -528,9 +544,18 @@ Model::start()
     } else {
 	simulation_flags = simulation_flags | RPF_WARNING;
     }
+    if ( check_stacks ) {
+	simulation_flags = simulation_flags | RPF_STACK_CHECK;
+    }
 
     deferred_exception = false;
-    ps_run_parasol( _parameters._run_time+1.0, _parameters._seed, simulation_flags );	/* Calls ps_genesis */
+    result_t::clear_registry();
+    Random::seed( _parameters._seed );
+    if ( __replications > 1 && !no_execute_flag ) {
+	replicate( simulation_flags );
+    } else {
+	ps_run_parasol( _parameters._run_time+1.0, _parameters._seed, simulation_flags );	/* Calls ps_genesis */
+    }
 
     /*
      * Run completed.
@@ -627,6 +652,208 @@ Model::restart()
     }
 }
 
+/*
+ * Run __replications independent simulations, __jobs at a time.  The
+ * first replication runs in this process with the seed given for the
+ * model.  The others are started by a spawner, forked before we run so
+ * that every worker starts from the same state as the first
+ * replication, whatever it leaves behind.  Each worker has its own seed
+ * and writes the sums of all of its results to a temporary file.  A
+ * new one is started as soon as any worker finishes.  The sums are
+ * added to ours in the order of the replications, as though they were
+ * more blocks of the same run, so the results do not depend on the
+ * number of jobs.  Once the precision is met, no more are started and
+ * the workers for later replications are stopped.  Histograms are
+ * taken from the first replication only.
+ */
+
+void
+Model::replicate( int simulation_flags )
+{
+#if HAVE_FORK && HAVE_SYS_WAIT_H
+    std::vector<FILE *> sums( __replications, nullptr );
+    std::vector<bool> done( __replications, false );
+    unsigned int next = 1;				/* Next to start */
+    unsigned int merged = 1;				/* Next to add to ours */
+    unsigned int running = 0;
+    int request[2];					/* Replications to start */
+    int reply[2];					/* Replications finished */
+
+    for ( unsigned int r = 1; r < __replications; ++r ) {
+	sums[r] = tmpfile();
+	if ( sums[r] == nullptr ) {
+	    throw std::runtime_error( "tmpfile" );
+	}
+    }
+    if ( pipe( request ) < 0 || pipe( reply ) < 0 ) {
+	throw std::runtime_error( "pipe" );
+    }
+    fflush( nullptr );
+    std::cout.flush();
+    std::cerr.flush();
+    const pid_t spawner = fork();
+    if ( spawner < 0 ) {
+	throw std::runtime_error( "fork" );
+    } else if ( spawner == 0 ) {
+	close( request[1] );
+	close( reply[0] );
+	spawn_replications( request[0], reply[1], simulation_flags, sums );
+    }
+    close( request[0] );
+    close( reply[1] );
+
+    for ( ; next < __replications && next < __jobs; ++next, ++running ) {
+	if ( write( request[1], &next, sizeof( next ) ) != sizeof( next ) ) break;
+    }
+
+    ps_run_parasol( _parameters._run_time+1.0, _parameters._seed, simulation_flags );	/* Calls ps_genesis */
+    unsigned long blocks = number_blocks - 1;
+    bool lost = messages_lost;
+    _confidence = rms_confidence();
+    bool stop = deferred_exception || (_parameters._precision > 0.0 && _confidence <= _parameters._precision);
+
+    while ( !stop && (merged < __replications) ) {
+	for ( ; next < __replications && running < __jobs; ++next, ++running ) {
+	    if ( write( request[1], &next, sizeof( next ) ) != sizeof( next ) ) break;
+	}
+
+	/* Wait for any worker, then add every finished replication that is next in order. */
+
+	unsigned int finished[2];			/* Replication, exit status */
+	if ( read( reply[0], finished, sizeof( finished ) ) != sizeof( finished ) || finished[1] != 0 || __replications <= finished[0] ) {
+	    deferred_exception = true;
+	    break;
+	}
+	done[finished[0]] = true;
+	running -= 1;
+
+	for ( ; merged < __replications && done[merged] && !stop; ++merged ) {
+	    unsigned long n = 0;
+	    bool worker_lost = false;
+	    FILE * file = sums[merged];
+	    rewind( file );
+	    if ( fread( &n, sizeof( n ), 1, file ) != 1
+		 || fread( &worker_lost, sizeof( worker_lost ), 1, file ) != 1
+		 || !result_t::merge( file ) ) {
+		deferred_exception = true;
+		stop = true;
+	    } else {
+		blocks += n;
+		lost = lost || worker_lost;
+		number_blocks = blocks + 1;		/* As left by run() */
+		_confidence = rms_confidence();
+		if ( verbose_flag ) {
+		    (void) fprintf( stderr, "Replication %u: %lu blocks [%.2g]\n", merged + 1, blocks, _confidence );
+		}
+		stop = _parameters._precision > 0.0 && _confidence <= _parameters._precision;
+	    }
+	}
+    }
+
+    /* The spawner stops the workers that are no longer needed. */
+
+    close( request[1] );
+    close( reply[0] );
+    waitpid( spawner, nullptr, 0 );
+    for ( std::vector<FILE *>::const_iterator file = sums.begin(); file != sums.end(); ++file ) {
+	if ( *file != nullptr ) fclose( *file );
+    }
+
+    number_blocks = blocks + 1;
+    messages_lost = lost;
+    if ( !deferred_exception ) {
+	insertDOMResults();
+    }
+#else
+    ps_run_parasol( _parameters._run_time+1.0, _parameters._seed, simulation_flags );	/* Calls ps_genesis */
+#endif
+}
+
+
+
+#if HAVE_FORK && HAVE_SYS_WAIT_H
+/*
+ * The spawner.  For each replication read from request, fork a
+ * process which runs the replication in a child of its own and writes
+ * the replication and its exit status to reply, so that a worker which
+ * dies is noticed too.  Once request is closed, any workers still
+ * running are stopped.  Only the workers take SIGTERM, so everything
+ * else is left to reap them.
+ */
+
+void
+Model::spawn_replications( int request, int reply, int simulation_flags, const std::vector<FILE *>& sums )
+{
+    setpgid( 0, 0 );
+    signal( SIGTERM, SIG_IGN );
+    unsigned int r = 0;
+    while ( read( request, &r, sizeof( r ) ) == sizeof( r ) ) {
+	while ( waitpid( -1, nullptr, WNOHANG ) > 0 );	/* Reap the finished ones */
+	if ( fork() != 0 ) continue;
+
+	const pid_t worker = fork();
+	if ( worker == 0 ) {
+	    signal( SIGTERM, SIG_DFL );
+	    run_replication( r, simulation_flags, sums.at(r) );
+	}
+	int status = 0;
+	if ( worker < 0 || waitpid( worker, &status, 0 ) != worker || !WIFEXITED( status ) ) {
+	    status = 1;
+	} else {
+	    status = WEXITSTATUS( status );
+	}
+	const unsigned int finished[2] = { r, static_cast<unsigned int>(status) };
+	_exit( write( reply, finished, sizeof( finished ) ) == sizeof( finished ) ? 0 : 1 );
+    }
+    kill( 0, SIGTERM );
+    while ( wait( nullptr ) > 0 );
+    _exit( 0 );
+}
+
+
+/*
+ * Run replication r and write its blocks, whether messages were lost
+ * and the sums of its results to sums.
+ */
+
+void
+Model::run_replication( unsigned int r, int simulation_flags, FILE * sums )
+{
+    verbose_flag = false;
+    __enable_print_interval = false;
+    result_t::clear_registry();
+    Random::seed( replication_seed( _parameters._seed, r ) );
+    ps_run_parasol( _parameters._run_time+1.0, replication_seed( _parameters._seed, r ), simulation_flags );
+    const unsigned long n = number_blocks - 1;
+    const bool ok = !deferred_exception && LQIO::io_vars.anError() == 0
+	&& fwrite( &n, sizeof( n ), 1, sums ) == 1
+	&& fwrite( &messages_lost, sizeof( messages_lost ), 1, sums ) == 1
+	&& result_t::save( sums );
+    fflush( nullptr );
+    _exit( ok ? 0 : 1 );
+}
+#endif
+
+
+
+/*
+ * The seed for replication r.  Replication 0 uses the seed of the
+ * model so that a single replication is the same as a normal run.  The
+ * others are scattered by a hash so that neighbouring replications do
+ * not get neighbouring seeds.
+ */
+
+unsigned long
+Model::replication_seed( unsigned long seed, unsigned int r )
+{
+    if ( r == 0 ) return seed;
+    uint64_t z = static_cast<uint64_t>(seed) + static_cast<uint64_t>(r) * 0x9e3779b97f4a7c15ULL;
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+    z = z ^ (z >> 31);
+    return static_cast<unsigned long>(z & 0x7fffffff);		/* Parasol wants a positive long */
+}
+
 /* ------------------------------------------------------------------------ */
 
 /*
@@ -657,6 +884,16 @@ Model::run( int task_id )
 	    rc = true;
 	} else {
 
+	    /*
+	     * Each customer has at most one request or reply in flight, and
+	     * each instance at most one pending event, so size the PARASOL
+	     * message and event slabs for that up front.
+	     */
+
+	    const unsigned long customers = std::accumulate( Task::__tasks.begin(), Task::__tasks.end(), 0UL, []( unsigned long n, const Task * task ){ return task->is_reference_task() ? n + task->multiplicity() : n; } );
+	    const unsigned long pooled = std::accumulate( Task::__tasks.begin(), Task::__tasks.end(), 0UL, []( unsigned long n, const Task * task ){ return n + task->msg_pool_size(); } );
+	    ps_slab_reserve( customers + pooled, total_tasks + 1 );
+
 	    /*
 	     * Start all of the tasks.
 	     */
@@ -133,7 +133,13 @@ private:
     void print_raw_stats( FILE * output ) const;
     
     bool run( int );
+    void replicate( int );
+#if HAVE_FORK && HAVE_SYS_WAIT_H
+    void spawn_replications( int, int, int, const std::vector<FILE *>& );
+    void run_replication( unsigned int, int, FILE * );
+#endif
     static void start_task( Task * );
+    static unsigned long replication_seed( unsigned long, unsigned int );
 
     static double rms_confidence();
     static double normalized_conf95( const result_t& stat );
@@ -154,6 +160,8 @@ public:
     static double max_service;			/* Max service time found.	*/
     static bool __enable_print_interval;
     static unsigned int __print_interval;	/* Value set by input file.	*/
+    static unsigned int __replications;		/* Independent runs.		*/
+    static unsigned int __jobs;			/* Runs at the same time.	*/
 };
 
 double square( const double arg );
@@ -0,0 +1,142 @@
+/* random.cc	-- Independent random number streams.
+ *
+ * ------------------------------------------------------------------------
+ * $Id$
+ * ------------------------------------------------------------------------
+ */
+
+#include <cstring>
+#include "random.h"
+
+uint64_t Random::__seed = 0;
+unsigned int Random::__epoch = 1;
+
+/*
+ * Start all of the streams over using the seed.  Streams notice the
+ * new epoch the next time they are used.
+ */
+
+void
+Random::seed( unsigned long seed )
+{
+    __seed = seed;
+    __epoch += 1;
+}
+
+
+/*
+ * Select the stream by name (FNV-1a hash).
+ */
+
+Random&
+Random::set_stream( const std::string& name )
+{
+    uint64_t hash = 0xcbf29ce484222325ULL;
+    for ( std::string::const_iterator c = name.begin(); c != name.end(); ++c ) {
+	hash = (hash ^ static_cast<unsigned char>(*c)) * 0x100000001b3ULL;
+    }
+    _stream = hash;
+    _epoch = 0;
+    return *this;
+}
+
+
+/*
+ * Philox4x32-10 (Salmon et al., SC'11).  The counter is the block
+ * number and the stream number, the key is the seed.
+ */
+
+void
+Random::next_block()
+{
+    if ( _epoch != __epoch ) {
+	_epoch = __epoch;
+	_counter = 0;
+	_next_exponential = EXPONENTIAL_BATCH;
+    }
+    uint32_t c0 = static_cast<uint32_t>(_counter);
+    uint32_t c1 = static_cast<uint32_t>(_counter >> 32);
+    uint32_t c2 = static_cast<uint32_t>(_stream);
+    uint32_t c3 = static_cast<uint32_t>(_stream >> 32);
+    uint32_t k0 = static_cast<uint32_t>(__seed);
+    uint32_t k1 = static_cast<uint32_t>(__seed >> 32);
+    for ( unsigned int round = 0; round < 10; ++round ) {
+	const uint64_t p0 = static_cast<uint64_t>(0xD2511F53) * c0;
+	const uint64_t p1 = static_cast<uint64_t>(0xCD9E8D57) * c2;
+	c0 = static_cast<uint32_t>(p1 >> 32) ^ c1 ^ k0;
+	c1 = static_cast<uint32_t>(p1);
+	c2 = static_cast<uint32_t>(p0 >> 32) ^ c3 ^ k1;
+	c3 = static_cast<uint32_t>(p0);
+	k0 += 0x9E3779B9;
+	k1 += 0xBB67AE85;
+    }
+    _block[0] = c0;
+    _block[1] = c1;
+    _block[2] = c2;
+    _block[3] = c3;
+    _counter += 1;
+    _used = 0;
+}
+
+
+/*
+ * Natural logarithm of a positive, normal x (fdlibm's __ieee754_log
+ * without the special cases).  x is split as 2^k * (1+f) with 1+f in
+ * [sqrt(2)/2, sqrt(2)) using integer operations only, so that a loop
+ * calling it can be vectorized without -ffast-math or a vector math
+ * library.  The result is within one ulp of std::log().
+ */
+
+static inline double
+log_kernel( double x )
+{
+    static const double ln2_hi = 6.93147180369123816490e-01;
+    static const double ln2_lo = 1.90821492927058770002e-10;
+    static const double Lg1 = 6.666666666666735130e-01;
+    static const double Lg2 = 3.999999999940941908e-01;
+    static const double Lg3 = 2.857142874366239149e-01;
+    static const double Lg4 = 2.222219843214978396e-01;
+    static const double Lg5 = 1.818357216161805012e-01;
+    static const double Lg6 = 1.531383769920937332e-01;
+    static const double Lg7 = 1.479819860511658591e-01;
+
+    uint64_t bits;
+    std::memcpy( &bits, &x, sizeof( bits ) );
+    bits += 0x3ff0000000000000ULL - 0x3fe6a09e667f3bcdULL;	/* Biased exponent of x/sqrt(2) */
+    uint64_t e = 0x4330000000000000ULL | (bits >> 52);		/* 2^52 + exponent, as a double */
+    double k;
+    std::memcpy( &k, &e, sizeof( k ) );
+    k -= 4503599627370496.0 + 1023.0;
+    bits = (bits & 0x000fffffffffffffULL) + 0x3fe6a09e667f3bcdULL;
+    double m;
+    std::memcpy( &m, &bits, sizeof( m ) );
+
+    const double f = m - 1.0;
+    const double hfsq = 0.5 * f * f;
+    const double s = f / (2.0 + f);
+    const double z = s * s;
+    const double w = z * z;
+    const double t1 = w * (Lg2 + w * (Lg4 + w * Lg6));
+    const double t2 = z * (Lg1 + w * (Lg3 + w * (Lg5 + w * Lg7)));
+    return s * (hfsq + t1 + t2) + k * ln2_lo - hfsq + f + k * ln2_hi;
+}
+
+
+/*
+ * Refill the batch of exponential variates of mean one.  The uniforms
+ * are drawn first so that the logarithms are taken in a separate loop.
+ * With log_kernel() and a fixed trip count, that loop is vectorized
+ * at -O2 as well as -O3.
+ */
+
+void
+Random::next_exponentials()
+{
+    for ( unsigned int i = 0; i < EXPONENTIAL_BATCH; ++i ) {
+	_exponential[i] = uniform();
+    }
+    for ( unsigned int i = 0; i < EXPONENTIAL_BATCH; ++i ) {
+	_exponential[i] = -log_kernel( _exponential[i] );
+    }
+    _next_exponential = 0;
+}
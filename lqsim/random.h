@@ -0,0 +1,67 @@
+/* -*- c++ -*-
+ *
+ * Independent random number streams for the simulation.
+ *
+ * ------------------------------------------------------------------------
+ * $Id$
+ * ------------------------------------------------------------------------
+ */
+
+#ifndef _RANDOM_H
+#define _RANDOM_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+/*
+ * A stream of uniform variates from the Philox4x32-10 counter based
+ * generator.  The n'th block of a stream is a function of the seed,
+ * the stream number and n only, so each task, activity and activity
+ * list draws from its own stream regardless of the order of events.
+ * The stream number is a hash of the name of the owner, so the same
+ * object gets the same stream in variants of a model.  Random::seed()
+ * starts every stream over at the beginning of a run.
+ */
+
+class Random {
+    static const unsigned int EXPONENTIAL_BATCH = 16;
+
+public:
+    Random() : _stream(0), _counter(0), _epoch(0), _used(4), _next_exponential(EXPONENTIAL_BATCH) {}
+
+    Random& set_stream( const std::string& name );
+
+    double uniform()				/* On (0,1)			*/
+	{
+	    if ( _used >= 4 || _epoch != __epoch ) next_block();
+	    const uint64_t x = (static_cast<uint64_t>(_block[_used]) << 32) | _block[_used+1];
+	    _used += 2;
+	    return ((x >> 11) + 0.5) * 0x1.0p-53;
+	}
+    size_t choice( size_t n ) { return static_cast<size_t>( n * uniform() ); }
+    double exponential( double mean )		/* From a batch of variates.	*/
+	{
+	    if ( _next_exponential >= EXPONENTIAL_BATCH || _epoch != __epoch ) next_exponentials();
+	    return mean * _exponential[_next_exponential++];
+	}
+
+    static void seed( unsigned long );
+
+private:
+    void next_block();
+    void next_exponentials();
+
+private:
+    uint64_t _stream;			/* Hash of the owner's name.	*/
+    uint64_t _counter;			/* Next block of the stream.	*/
+    unsigned int _epoch;		/* Run the counter belongs to.	*/
+    unsigned int _used;			/* Words used from _block.	*/
+    uint32_t _block[4];
+    unsigned int _next_exponential;
+    double _exponential[EXPONENTIAL_BATCH];
+
+    static uint64_t __seed;
+    static unsigned int __epoch;
+};
+#endif
@@ -8,6 +8,7 @@
 
 #include "lqsim.h"
 #include <cstdarg>
+#include <set>
 #include "result.h"
 #include "model.h"
 
@@ -17,6 +18,13 @@
 
 unsigned long number_blocks;
 
+/*
+ * Every result initialized during a run, so that the sums from
+ * independent replications can be added together.
+ */
+
+std::vector<result_t *> result_t::__results;
+
 /*
  * Calculate the t1 and t2 values used for estimating the confidence
  * intervals.
@@ -86,6 +94,7 @@ result_t::init( int type, const char * format, ... )
 
     raw = ps_open_stat( buf, _type );
     clear_results();
+    __results.push_back( this );
 }
 
 
@@ -94,6 +103,7 @@ result_t::init( const long stat_id )
 {
     raw = stat_id;		/* We already have a stat.  just set it up. */
     clear_results();
+    __results.push_back( this );
 }
 
 
@@ -316,3 +326,65 @@ result_t::print_raw( FILE * output, const char * format,... ) const
     }
     return output;
 }
+
+
+/*
+ * The results in the order in which they were initialized, less any
+ * which were initialized more than once.  The model is built the same
+ * way in every replication, so the order is the same in each.
+ */
+
+std::vector<result_t *>
+result_t::registered()
+{
+    std::vector<result_t *> results;
+    std::set<const result_t *> seen;
+    for ( std::vector<result_t *>::const_iterator result = __results.begin(); result != __results.end(); ++result ) {
+	if ( seen.insert( *result ).second ) {
+	    results.push_back( *result );
+	}
+    }
+    return results;
+}
+
+
+/*
+ * Write the sums of all results from this replication.
+ */
+
+bool
+result_t::save( FILE * output )
+{
+    const std::vector<result_t *> results = registered();
+    const size_t n = results.size();
+    if ( fwrite( &n, sizeof( n ), 1, output ) != 1 ) return false;
+    for ( std::vector<result_t *>::const_iterator result = results.begin(); result != results.end(); ++result ) {
+	const double sums[5] = { (*result)->_sum, (*result)->_sum_sqr, (*result)->_count, (*result)->_count_sqr, static_cast<double>((*result)->_n) };
+	if ( fwrite( sums, sizeof( sums ), 1, output ) != 1 ) return false;
+    }
+    return true;
+}
+
+
+/*
+ * Add the sums from another replication to ours.  The blocks of the
+ * other replication are treated as more blocks of this one.
+ */
+
+bool
+result_t::merge( FILE * input )
+{
+    const std::vector<result_t *> results = registered();
+    size_t n = 0;
+    if ( fread( &n, sizeof( n ), 1, input ) != 1 || n != results.size() ) return false;
+    for ( std::vector<result_t *>::const_iterator result = results.begin(); result != results.end(); ++result ) {
+	double sums[5];
+	if ( fread( sums, sizeof( sums ), 1, input ) != 1 ) return false;
+	(*result)->_sum       += sums[0];
+	(*result)->_sum_sqr   += sums[1];
+	(*result)->_count     += sums[2];
+	(*result)->_count_sqr += sums[3];
+	(*result)->_n         += static_cast<unsigned>(sums[4]);
+    }
+    return true;
+}
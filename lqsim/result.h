@@ -8,6 +8,9 @@
 #ifndef _RESULT_H
 #define _RESULT_H
 
+#include <cstdio>
+#include <vector>
+
 extern unsigned long number_blocks;	/* For block statistics. 	*/
 
 
@@ -34,6 +37,13 @@ public:
 
     FILE * print_raw( FILE * output, const char * format, ... ) const;
 
+    static void clear_registry() { __results.clear(); }
+    static bool save( FILE * output );
+    static bool merge( FILE * input );
+
+private:
+    static std::vector<result_t *> registered();
+
 public:
     long raw;			/* index to raw value.		*/
      
@@ -47,6 +57,8 @@ private:
 
 private:
     int _type;
+
+    static std::vector<result_t *> __results;	/* In order of init().	*/
 };
 
 
@@ -313,7 +313,7 @@ Targets::initialize( const char * srcName )
  */
 
 tar_t *
-Targets::entry_to_send_to ( unsigned int&i, unsigned int& j ) const
+Targets::entry_to_send_to ( unsigned int&i, unsigned int& j, Random& random ) const
 {
     if ( size() != 0 ) {
 	double	p;		/* branch probability		*/
@@ -321,7 +321,7 @@ Targets::entry_to_send_to ( unsigned int&i, unsigned int& j ) const
 	switch ( _type ) {
 
 	case LQIO::DOM::Phase::Type::STOCHASTIC:
-	    p = ps_random;
+	    p = random.uniform();
 	    for ( i = 0; i < size() && p >= _target[i]._tprob; i = i + 1 );
 	    break;
 
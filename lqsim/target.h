@@ -12,6 +12,7 @@
 #include <deque>
 #include <vector>
 #include <assert.h>
+#include "random.h"
 #include "result.h"
 #include <lqio/dom_call.h>
 #include <lqio/dom_phase.h>
@@ -88,7 +89,7 @@ public:
     void store_target_info( Entry * to_entry, double );
     double configure( const LQIO::DOM::DocumentObject * dom, bool normalize );
     void initialize( const char * );
-    tar_t * entry_to_send_to( unsigned int& i, unsigned int& j ) const;
+    tar_t * entry_to_send_to( unsigned int& i, unsigned int& j, Random& random ) const;
     const Targets& print_raw_stat( FILE * ) const;
 
     Targets& reset_stats();
@@ -78,7 +78,12 @@ Task::Task( const Task::Type type, int priority, LQIO::DOM::Task* dom, Processor
       _joins(),
       _pending_msgs(),
       _join_start_time(0.0),
-      _free_msgs(),
+      _random(),
+      _msg_pool(),
+      _free_msgs(nullptr),
+      _msgs_in_use(0),
+      _msgs_peak(0),
+      _msgs_allocated(0),
       _type(type),
       _entry(),
       _activity(),
@@ -100,7 +105,6 @@ Task::~Task()
 {
     std::for_each( _activity.begin(), _activity.end(), Delete<Activity *> );
     std::for_each( _act_list.begin(), _act_list.end(), Delete<ActivityList *> );
-    std::for_each( _free_msgs.begin(), _free_msgs.end(), Delete<Message *> );
 
     if ( _hist_data ) {
 	delete _hist_data;
@@ -118,8 +122,12 @@ Task::configure()
 {
     /* I need the instance variable "task" set from this point on. */
 
+    _random.set_stream( name() );
     double total_calls = std::accumulate( _activity.begin(), _activity.end(), 0.0, []( double l, Activity * r ){ return l + r->configure(); } );
     std::for_each( _act_list.begin(), _act_list.end(), std::mem_fn( &ActivityList::configure ) );
+    for ( std::vector<ActivityList *>::const_iterator list = _act_list.begin(); list != _act_list.end(); ++list ) {
+	(*list)->random().set_stream( name() + "/" + (*list)->get_name() );
+    }
     total_calls = std::accumulate( _entry.begin(), _entry.end(), total_calls, []( double l, Entry * r ) { return l + r->configure(); } );
 
     if ( total_calls == 0 && is_reference_task() ) {
@@ -173,6 +181,9 @@ Task::create()
 
     build_links();
 
+    /* Messages left blocked by a join in the last run point into the old pool. */
+
+    _pending_msgs.clear();
     if ( has_send_no_reply() ) {
 	alloc_pool();
     }
@@ -336,19 +347,30 @@ Task::alloc_pool()
 	    getDOM()->throw_invalid_parameter( "pool size", e.what() );
 	}
     }
-    for ( unsigned int i = 0; i < size; ++i ) {
-	_free_msgs.push_back( new Message );
+
+    /* Rebuilt for each run, so messages still queued when the last run ended are reclaimed. */
+
+    _msg_pool.assign( size, Message() );
+    _free_msgs = nullptr;
+    for ( std::vector<Message>::reverse_iterator msg = _msg_pool.rbegin(); msg != _msg_pool.rend(); ++msg ) {
+	msg->next = _free_msgs;
+	_free_msgs = &*msg;
     }
+    _msgs_in_use = 0;
+    _msgs_peak = 0;
+    _msgs_allocated = 0;
 }
 
 
 Message *
 Task::alloc_message()
 {
-    Message * msg = nullptr;
-    if ( _free_msgs.size() > 0 ) {
-	msg = _free_msgs.front();
-	_free_msgs.pop_front();
+    Message * msg = _free_msgs;
+    if ( msg != nullptr ) {
+	_free_msgs = msg->next;
+	_msgs_in_use += 1;
+	_msgs_peak = std::max( _msgs_peak, _msgs_in_use );
+	_msgs_allocated += 1;
     }
     return msg;
 }
@@ -362,7 +384,22 @@ Task::free_message( Message * msg )
     tar_t *tp = msg->target;
     ps_record_stat( tp->r_delay.raw, delta );
     ps_record_stat( tp->r_delay_sqr.raw, square( delta ) );
-    _free_msgs.push_back( msg );
+    msg->next = _free_msgs;
+    _free_msgs = msg;
+    _msgs_in_use -= 1;
+}
+
+
+/*
+ * Size and usage of the pool of messages for send-no-reply.
+ */
+
+FILE *
+Task::print_msg_pool( FILE * output ) const
+{
+    if ( _msg_pool.empty() ) return output;
+    (void) fprintf( output, "%-6.6s %-11.11s - Msg Pool     %8zu %8u %12lu\n", type_name().c_str(), name().c_str(), _msg_pool.size(), _msgs_peak, _msgs_allocated );
+    return output;
 }
 
 double
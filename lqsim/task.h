@@ -25,6 +25,7 @@
 #include <lqio/dom_task.h>
 #include <parasol/parasol.h>
 
+#include "random.h"
 #include "result.h"
 #include "entry.h"
 #include "message.h"
@@ -136,12 +137,14 @@ public:
     Task& set_group_id( int group_id ) { _group_id = group_id; return *this; }
     Message * alloc_message();
     void free_message( Message * msg );
+    unsigned msg_pool_size() const { return _msg_pool.size(); }
 
     Activity * find_activity( const char * activity_name ) const;
 
     bool is_infinite() const;
     bool is_multiserver() const { return multiplicity() > 1; }
     bool is_reference_task() const { return type() == Type::CLIENT; }
+    FILE * print_msg_pool( FILE * ) const;
     virtual bool is_sync_server() const { return false; }
     virtual bool is_aysnc_inf_server() const { return false; }
     bool has_activities() const { return _activity.size() > 0; }	/* True if activities present.	*/
@@ -154,6 +157,7 @@ public:
     Activity * add_activity( LQIO::DOM::Activity * activity );
     unsigned max_activities() const { return _activity.size(); }	/* Max # of activities.		*/
     Task& add_list( ActivityList * list ) { _act_list.push_back( list ); return *this; }
+    Random& random() { return _random; }
     Task& add_fork( AndForkActivityList * list ) { _forks.push_back( list ); return *this; }
     Task& add_join( AndJoinActivityList * list ) { _joins.push_back( list ); return *this; }
 
@@ -195,8 +199,13 @@ private:
     std::vector<AndJoinActivityList *> _joins; 	/* List of joins for this task	*/
     std::list<Message *> _pending_msgs;		/* Messages blocked by join.	*/
     double _join_start_time;			/* non-zero if in sync-join	*/
+    Random _random;				/* Think time, entry choice.	*/
 
-    std::list<Message *> _free_msgs;		/* Pool of messages 		*/
+    std::vector<Message> _msg_pool;		/* Pool of messages 		*/
+    Message * _free_msgs;			/* Free list through the pool.	*/
+    unsigned _msgs_in_use;			/* Messages taken from pool.	*/
+    unsigned _msgs_peak;			/* Most messages in use.	*/
+    unsigned long _msgs_allocated;		/* Number of alloc_message().	*/
 
 protected:
     Type _type;
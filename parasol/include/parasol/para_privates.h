@@ -241,8 +241,28 @@ LOCAL	void	find_ready_cfs(
 
 LOCAL	void	init_event(void);
 
-/* Initializes the event free list to empty and also the event calendar	*/
-/* to empty.								*/
+/* Returns all events to the free list and initializes the event 	*/
+/* calendar to empty.							*/
+
+/************************************************************************/
+
+LOCAL	void	init_event_lanes(
+
+/* Clears the express lanes of a new event.  Called once for each event	*/
+/* when its slab is allocated.						*/
+
+	void	*obj				/* event pointer	*/
+);
+
+/************************************************************************/
+
+LOCAL	void	set_event_lanes(
+
+/* Draws the express lane count of an event being added to the calendar	*/
+/* and makes room for its lane pointers.				*/
+
+	ps_event_t	*ep			/* event pointer	*/
+);
 
 /************************************************************************/
 
@@ -255,6 +275,15 @@ LOCAL	ps_event_t	*next_event(void);
 
 /************************************************************************/
 
+LOCAL	void	unlink_lanes(
+
+/* Removes an event from the calendar express lanes it is in.		*/
+
+	ps_event_t	*ep			/* event pointer	*/
+);
+
+/************************************************************************/
+
 LOCAL	void	ready(
 
 /* Makes the given task TASK_READY and queues it on the appropriate	*/
@@ -681,7 +710,37 @@ LOCAL	void	trace_rep(void);
 
 /* This is representative of the PARASOL tracing function ts_report	*/
  
-#if !HAVE_SIGALTSTACK || _WIN32 || _WIN64
+#if PS_ASM_CONTEXT
+/************************************************************************/
+
+LOCAL	void	mctx_boot(void);
+
+/* Starts a new task on its own stack and handles default termination.	*/
+
+/************************************************************************/
+
+LOCAL	void	mctx_init(
+
+/* Builds the initial context of a task so that the first switch to it	*/
+/* enters mctx_boot on the top of the stack.				*/
+
+	mctx_t	*mctx,				/* context buffer	*/
+	void	*sk_addr,			/* stack base		*/
+	size_t	sk_size				/* stack size in bytes	*/
+);
+
+/************************************************************************/
+
+void	mctx_switch(
+
+/* Saves the callee-saved registers on the current stack and its stack	*/
+/* pointer in "old_sp", then resumes the context saved at "new_sp".	*/
+/* Written in assembler in para_library.c.				*/
+
+	void	**old_sp,			/* save current sp here	*/
+	void	*new_sp				/* sp to resume		*/
+);
+#elif !HAVE_SIGALTSTACK || _WIN32 || _WIN64
 /************************************************************************/
 
 LOCAL	void	wrapper(
@@ -694,6 +753,77 @@ LOCAL	void	wrapper(
 #endif
 
 
+/************************************************************************/
+
+LOCAL	double	*stack_alloc(
+
+/* Returns a task stack of at least "*sizep" bytes, from the pool of	*/
+/* free stacks when possible.  "*sizep" is set to the actual size.	*/
+
+	long	*sizep				/* stack size pointer	*/
+);
+
+/************************************************************************/
+
+LOCAL	void	stack_free(
+
+/* Returns a task stack to the pool.					*/
+
+	double	*base,				/* stack base		*/
+	long	size				/* stack size in bytes	*/
+);
+
+/************************************************************************/
+
+LOCAL	void	*slab_alloc(
+
+/* Takes an object from the free list of the slab allocator "sp",	*/
+/* allocating a new slab when the free list is empty.			*/
+
+	ps_slab_t	*sp			/* slab pointer		*/
+);
+
+/************************************************************************/
+
+LOCAL	void	slab_free(
+
+/* Returns an object to the free list of the slab allocator "sp".	*/
+
+	ps_slab_t	*sp,			/* slab pointer		*/
+	void		*obj			/* object pointer	*/
+);
+
+/************************************************************************/
+
+LOCAL	void	slab_grow(
+
+/* Allocates a slab of "n" objects and adds them to the free list.	*/
+
+	ps_slab_t	*sp,			/* slab pointer		*/
+	long		n			/* # objects		*/
+);
+
+/************************************************************************/
+
+LOCAL	void	slab_link(
+
+/* Threads the objects of slab "hp" onto the free list of "sp" so that	*/
+/* they are handed out in address order.				*/
+
+	ps_slab_t	*sp,			/* slab pointer		*/
+	ps_slab_hdr_t	*hp			/* slab header pointer	*/
+);
+
+/************************************************************************/
+
+LOCAL	void	slab_reset(
+
+/* Returns every object in every slab to the free list.  Objects	*/
+/* still in use from a previous run are reclaimed this way.		*/
+
+	ps_slab_t	*sp			/* slab pointer		*/
+);
+
 /************************************************************************/
 
 LOCAL	long	sp_tester(
@@ -869,7 +999,9 @@ void cap_handler(ps_task_t *tp);
 #endif
 #endif
 
-#if	!HAVE_SIGALTSTACK && !_WIN32 && !_WIN64
+#if	PS_ASM_CONTEXT
+#define ctxsw(old,new)	mctx_switch(&(old)->sp, (new)->sp)
+#elif	!HAVE_SIGALTSTACK && !_WIN32 && !_WIN64
 #define mctx_save(mctx) _setjmp((mctx)->jb) 		/* save machine context */ 
 #define mctx_restore(mctx) _longjmp((mctx)->jb, 1)	/* restore machine context */
 #define ctxsw(old,new)	if(!_setjmp((old)->jb)) _longjmp((new)->jb, 1)
@@ -915,6 +1047,19 @@ void cap_handler(ps_task_t *tp);
 #define	USER_EVENT	13			/* user defined event(s)*/
 #define	CALENDAR	1000			/* calendar head & tail	*/
 
+/*	Calendar express lanes.  One event in four is in lane 1, one in	*/
+/*	sixteen in lane 2, and so on, so a search skips over most of the	*/
+/*	calendar.  Lane l of an event links to the next and prior events	*/
+/*	which are also in lane l.  The lanes sit on top of the time	*/
+/*	ordered list rather than replacing it with a heap: remove_event	*/
+/*	unlinks a cancelled event in place, the future events report	*/
+/*	walks the list, and events at equal times keep the order of the	*/
+/*	old linear merge, so simulations give the same results.		*/
+
+#define	CAL_LANES	12			/* express lanes	*/
+#define	LANE_NEXT(ep, l)	((ep)->lane[2*(l)-2])
+#define	LANE_PRIOR(ep, l)	((ep)->lane[2*(l)-1])
+
 /*	Lock states and flags						*/
 
 #define	UNLOCKED	0
@@ -970,6 +1115,7 @@ void cap_handler(ps_task_t *tp);
 #define DEFAULT_MAX_VARS	5
 #define DEFAULT_MAX_ENVS	5
 #define DEFAULT_MAX_DYES	2
+#define	MIN_SLAB_OBJECTS	100		/* smallest slab	*/
 
 #define	DRIVER		(-1)
 #define	NULL_EVENT	(-1)
@@ -1055,13 +1201,16 @@ LOCAL rb_node leaf = { RB_BLACK, NIL, NIL, NIL, 0.0,NULL_SCHED_PTR};
 extern long ps_trsct;				/* trace_rep stack ctest*/
 
 LOCAL	ps_event_t	calendar[2];		/* future event list	*/
-LOCAL	ps_event_t	*event_fl;		/* event free list	*/
+LOCAL	ps_event_t	*cal_lane[2][2*CAL_LANES];	/* calendar lanes	*/
+LOCAL	unsigned long	lane_seed;		/* express lane draws	*/
+#if	HAVE_MMAP && HAVE_SYS_MMAN_H
+LOCAL	ps_stack_t	*stack_fl;		/* free stack list	*/
+#endif
 LOCAL	mctx_t	d_context;			/* driver context	*/
 LOCAL	long	step_flag;			/* single step flag	*/
 LOCAL	long	break_flag;			/* break polong flag	*/
 LOCAL	double	break_time;			/* break polong time	*/
 LOCAL	long	reaper_port;			/* grim reaper port	*/
-LOCAL	ps_mess_t *next_mess = NULL_MESS_PTR;	/* free mess pointer	*/
 LOCAL 	ps_tp_pair_t *tpflist = NULL_PAIR_PTR;	/* tp pair free list	*/
 LOCAL 	long	sp_dir;				/* stack direction flag	*/
 #if !HAVE_SIGALTSTACK || _WIN32 || _WIN64
@@ -1074,6 +1223,7 @@ LOCAL	double	bs_time;			/* block statistic time	*/
 LOCAL	long	qxflag = 0;			/* quantum expired flag	*/
 LOCAL	long	next_mid;			/* Message serial number*/
 #ifdef STACK_TESTING
+LOCAL	long	stack_check_flag;		/* paint & test stacks	*/
 LOCAL	long	max_stack;			/* Maximum stack used	*/
 #endif /* STACK_TESTING */
 LOCAL	ps_table_t	ps_dye_tab;		/* dye table		*/
@@ -198,6 +198,7 @@ extern	ps_table_t	ps_stat_tab;
 #define RPF_TRACE	0x01			/* Trace flag		*/
 #define RPF_STEP	0x02			/* Step(debugger) flag	*/
 #define RPF_WARNING	0x04			/* warning flag		*/
+#define RPF_STACK_CHECK	0x08			/* paint & test stacks	*/
 
 /************************************************************************/
 /*                 P A R A S O L   G L O B A L S			*/
@@ -1057,6 +1058,15 @@ extern	void	ps_stats(void);
 
 /************************************************************************/
 
+extern	void	ps_slab_stats(
+
+/* Reports the message and event allocator statistics for the run.	*/
+
+	FILE	*fp				/* output file		*/
+);
+
+/************************************************************************/
+
 extern SYSCALL	ps_add_stat(
 
 /* Adds a number to a statistic sample 	*/
@@ -1204,6 +1214,17 @@ extern SYSCALL	ps_run_parasol(
 
 /************************************************************************/
 
+extern SYSCALL	ps_slab_reserve(
+
+/* Preallocates message envelopes and events so that a run needing at	*/
+/* most this many of each does not allocate memory while it runs.	*/
+
+	long	messages,			/* # message envelopes	*/
+	long	events				/* # events		*/
+);
+
+/************************************************************************/
+
 SYSCALL	ps_schedule(
 
 /* For use by user defined scheduling functions only!!! schedules the	*/
@@ -68,12 +68,35 @@ typedef enum ps_task_state_t {
 
 /************************************************************************/
 
+/* On x86-64 ELF targets tasks switch with a short assembly routine	*/
+/* (mctx_switch) which only saves the registers the C calling		*/
+/* convention preserves.  Build with -DPS_ASM_CONTEXT=0 to use setjmp.	*/
+
+#if !defined(PS_ASM_CONTEXT)
+#if defined(__x86_64__) && defined(__ELF__) && defined(__GNUC__) && !_WIN32 && !_WIN64
+#define PS_ASM_CONTEXT	1
+#else
+#define PS_ASM_CONTEXT	0
+#endif
+#endif
+
 typedef struct mctx_st {
+#if PS_ASM_CONTEXT
+	void	*sp;				/* saved stack pointer	*/
+#else
 	jmp_buf jb;
+#endif
 } mctx_t;
 
 /************************************************************************/
 
+typedef	struct	ps_stack_t {			/* free stack struct	*/
+	struct	ps_stack_t	*next;		/* next free stack	*/
+	long	size;				/* usable size in bytes	*/
+} ps_stack_t;
+
+/************************************************************************/
+
 typedef	struct	ps_buf_t {
 	long	signature;			/* buffer signature	*/
 	long	pool;				/* buffer pool id	*/
@@ -133,6 +156,9 @@ typedef	struct	ps_event_t {			/* PARASOL event struct	*/
 	long	*gp;				/* generic pointer	*/
 	struct	ps_event_t	*next;		/* next event pointer	*/
 	struct	ps_event_t	*prior;		/* prior event pointer	*/
+	long	lanes;				/* express lane count	*/
+	long	lane_max;			/* lanes allocated	*/
+	struct	ps_event_t	**lane;		/* lane next/prior ptrs	*/
 } ps_event_t;
 
 /************************************************************************/
@@ -241,6 +267,27 @@ typedef	struct	ps_sema_t {			/* semaphore struct	*/
 
 /************************************************************************/
 
+typedef	struct	ps_slab_hdr_t {			/* slab header struct	*/
+	struct	ps_slab_hdr_t	*next;		/* next slab		*/
+	long	n;				/* # objects in slab	*/
+} ps_slab_hdr_t;
+
+typedef	struct	ps_slab_t {			/* slab allocator struct*/
+	const	char	*name;			/* object kind name	*/
+	size_t	size;				/* object size (bytes)	*/
+	size_t	link;				/* free link offset	*/
+	void	(*init)(void *);		/* new object setup	*/
+	ps_slab_hdr_t	*slabs;			/* slab list		*/
+	void	*free;				/* object free list	*/
+	long	nslabs;				/* # slabs allocated	*/
+	long	total;				/* # objects in slabs	*/
+	long	used;				/* # objects in use	*/
+	long	peak;				/* most objects in use	*/
+	long	allocs;				/* # allocations	*/
+} ps_slab_t;
+
+/************************************************************************/
+
 typedef	struct	ps_stat_t {			/* statistics struct	*/
 	char	*name;				/* statistic name	*/
 	double	resid;				/* non-rounding resid	*/
@@ -155,6 +155,16 @@
 #include <strings.h>
 #endif
 #include <setjmp.h>
+#include <stddef.h>
+#if HAVE_SYS_MMAN_H
+#include <sys/mman.h>
+#endif
+#if !defined(MAP_ANONYMOUS) && defined(MAP_ANON)
+#define MAP_ANONYMOUS	MAP_ANON
+#endif
+#if !defined(MAP_NORESERVE)
+#define MAP_NORESERVE	0
+#endif
 
 #define TEMP_STR_SIZE	128
 
@@ -177,6 +187,14 @@ double		ps_run_time;			/* stop time		*/
 long		ps_trsct;			/* trace_rep stack ctest*/
 unsigned        first_run = TRUE;
 
+/* The slab allocators are defined here rather than in para_privates.h	*/
+/* so that only this file refers to init_event_lanes.			*/
+
+LOCAL	ps_slab_t	event_slab = { "event", sizeof(ps_event_t), 
+    offsetof(ps_event_t, prior), init_event_lanes };	/* event allocator	*/
+LOCAL	ps_slab_t	mess_slab = { "message", sizeof(ps_mess_t), 
+    offsetof(ps_mess_t, next), NULL };		/* message allocator	*/
+
 /************************************************************************/
 /*	P A R A S O L   L I B R A R Y   D I R E C T O R Y		*/
 /*									*/
@@ -204,11 +222,12 @@ unsigned        first_run = TRUE;
 /*	Statistics Related SYSCALLs:					*/
 /*		ps_block_stats, ps_get_stat, ps_open_stat, 		*/
 /*		ps_record_stat, ps_reset_stat, ps_reset_all_stats,	*/
-/*		ps_stats						*/
+/*		ps_slab_stats, ps_stats					*/
 /*									*/
 /*	Miscellaneous SYSCALL						*/
 /*		ps_build_bus, ps_build_link, ps_build_node, ps_erlang,	*/
-/*		ps_headroom, ps_run_parasol, ps_abort, ps_curr_priority	*/
+/*		ps_headroom, ps_run_parasol, ps_abort, ps_curr_priority,*/
+/*		ps_slab_reserve						*/
 /*									*/
 /*	Angio Tracing SYSCALLS:						*/
 /*		ps_inject_trace_name, ps_task_cycle, ps_user_event	*/
@@ -232,8 +251,10 @@ unsigned        first_run = TRUE;
 /*									*/
 /*	Scheduler Support Functions:					*/
 /*		add_event, ctxsw, dq_ready, find_host, find_priority,	*/
-/*		find_ready, init_event, next_event, private_priority,	*/
-/*		ready, remove_event, sched				*/
+/*		find_ready, init_event, init_event_lanes, mctx_boot,	*/
+/*		mctx_init, mctx_switch, next_event, private_priority,	*/
+/*		ready, remove_event, sched, set_event_lanes,		*/
+/*		unlink_lanes						*/
 /*									*/
 /*	Dynamic Table Support Functions:				*/
 /*		free_table_entry, get_table_entry, init_table		*/
@@ -253,7 +274,10 @@ unsigned        first_run = TRUE;
 /*		ps_abort, ancestor, bad_param_helper, dq_lock,   	*/
 /*		free_mess, free_pair, get_mess, get_pair, init_locks, 	*/
 /*		init_semaphores, port_receive, port_send, relative, 	*/
-/*		release_locks, release_ports, warning, wrapper		*/
+/*		release_locks, release_ports, slab_alloc, slab_free,	*/
+/*		slab_grow, slab_link, slab_reset, stack_alloc,		*/
+/*		stack_free,						*/
+/*		warning, wrapper					*/
 /*									*/
 /************************************************************************/
 
@@ -543,7 +567,7 @@ SYSCALL	ps_create2(
 
 	tp->host = tp->uhost = host;
 	tp->hp = NULL_HOST_PTR;
-	if(!(tp->stack_base = (double *) malloc((unsigned)stacksize)))
+	if(!(tp->stack_base = stack_alloc(&stacksize)))
 		ps_abort("Insufficient memory");
 	if((adjustment = ((size_t)tp->stack_base % sizeof(double)))) {
 		adjustment = sizeof(double) - adjustment;
@@ -551,10 +575,13 @@ SYSCALL	ps_create2(
 	}
 	tp->stack_limit = tp->stack_base + stacksize/sizeof(double);
 #ifdef STACK_TESTING
-	memset (tp->stack_base, 0x55, stacksize);
+	if(stack_check_flag)
+		memset (tp->stack_base, 0x55, stacksize);
 #endif /*STACK_TESTING*/
 
-#if	HAVE_SIGALTSTACK && !_WIN32 && !_WIN64
+#if	PS_ASM_CONTEXT
+	mctx_init( &tp->context, tp->stack_base, stacksize );
+#elif	HAVE_SIGALTSTACK && !_WIN32 && !_WIN64
 	mctx_create( &tp->context, tp->code, 0, tp->stack_base, stacksize );
 #else
 	if(ps_htp == DRIVER_PTR) {
@@ -890,7 +917,7 @@ SYSCALL	ps_kill(
 #ifdef STACK_TESTING
 		test_stack(task);
 #endif /* STACK_TESTING */
-		free(tp->stack_base);
+		stack_free(tp->stack_base, (char *)tp->stack_limit - (char *)tp->stack_base);
 		break;
 
 	case TASK_SPINNING:
@@ -906,7 +933,7 @@ SYSCALL	ps_kill(
 #ifdef STACK_TESTING
 		test_stack(task);
 #endif /* STACK_TESTING */
-		free(tp->stack_base);
+		stack_free(tp->stack_base, (char *)tp->stack_limit - (char *)tp->stack_base);
 		find_ready(np, hp);	
 		break;
 	}
@@ -3242,6 +3269,29 @@ void	ps_stats(void)
 /*	Cleanup our working copy					*/
 	free (copy);
 }
+
+/************************************************************************/
+
+void	ps_slab_stats(
+
+/* Reports the message and event allocator statistics for the run.	*/
+
+	FILE	*fp				/* output file		*/
+)
+{
+	ps_slab_t	*slab[2];		/* allocators		*/
+	long	i;				/* loop index		*/
+
+	slab[0] = &mess_slab;
+	slab[1] = &event_slab;
+	fprintf(fp, "\nPARASOL allocation statistics for time = %G.\n", ps_now);
+	fprintf(fp, "\n Object\t\tSize\tSlabs\tObjects\tIn use\tPeak\tAllocs\n\n");
+	for(i = 0; i < 2; i++)
+		fprintf(fp, " %-8s\t%ld\t%ld\t%ld\t%ld\t%ld\t%ld\n", slab[i]->name,
+		    (long)slab[i]->size, slab[i]->nslabs, slab[i]->total,
+		    slab[i]->used, slab[i]->peak, slab[i]->allocs);
+	fprintf(fp, "\n");
+}
 	
 
 
@@ -3754,12 +3804,16 @@ SYSCALL	ps_run_parasol(
 	break_flag = FALSE;
 	ts_flag = (flags & RPF_TRACE) ? TRUE : FALSE;
 	w_flag = (flags & RPF_WARNING) ? TRUE : FALSE;
+#ifdef STACK_TESTING
+	stack_check_flag = (flags & RPF_STACK_CHECK) ? TRUE : FALSE;
+#endif /* STACK_TESTING */
 	bs_time = -1.0;
 	init_table(&ps_node_tab, DEFAULT_MAX_NODES, sizeof(ps_node_t));
 	init_table(&ps_group_tab, DEFAULT_MAX_GROUPS, sizeof(ps_group_t));
 	init_table(&ps_bus_tab, DEFAULT_MAX_BUSES, sizeof(ps_bus_t));
 	init_table(&ps_link_tab, DEFAULT_MAX_LINKS, sizeof(ps_link_t));
 	init_event();
+	slab_reset(&mess_slab);
 	init_locks();
 	init_semaphores();
 	init_table(&ps_port_tab, DEFAULT_MAX_PORTS, sizeof(ps_port_t));
@@ -3795,6 +3849,31 @@ SYSCALL	ps_run_parasol(
 
 /************************************************************************/
 
+SYSCALL	ps_slab_reserve(
+
+/* Preallocates message envelopes and events so that a run needing at	*/
+/* most this many of each does not allocate memory while it runs.	*/
+/* May be called before or during a run; the slabs are kept between	*/
+/* runs.								*/
+
+	long	messages,			/* # message envelopes	*/
+	long	events				/* # events		*/
+)
+{
+	if(messages < 0)
+		return(BAD_PARAM("messages"));
+	if(events < 0)
+		return(BAD_PARAM("events"));
+
+	if(mess_slab.total < messages)
+		slab_grow(&mess_slab, messages - mess_slab.total);
+	if(event_slab.total < events)
+		slab_grow(&event_slab, events - event_slab.total);
+	return OK;
+}
+
+/************************************************************************/
+
 SYSCALL	ps_schedule(
 
 /* For use by user defined scheduling functions only! Schedules the	*/
@@ -4792,50 +4871,54 @@ LOCAL	void	end_trans_handler(
 extern
 ps_event_t	*add_event(
 
-/* Gets an event struct from the free list and sets its fields.  This	*/
+/* Gets an event struct from the event slab and sets its fields.  This	*/
 /* event is then merged into the calendar according to event time and	*/
-/* a pointer to it is returned. 					*/
+/* a pointer to it is returned.  The express lanes are searched from	*/
+/* the top down, so the merge is O(log n) rather than a linear scan.	*/
+/* Events at the same time as others are placed ahead of them when the	*/
+/* time is nearer the head of the calendar than the tail, and after	*/
+/* them otherwise, which is where the old two-ended scan put them.	*/
 
 	double	time,				/* event time		*/
 	long	type,				/* primary event code	*/
 	long	*gp				/* generic pointer	*/
 )
 {
-	long	i;				/* loop index		*/
-	ps_event_t	*ep, *epf, *epl;	 /* event pointers	*/
+	long	l;				/* lane index		*/
+	long	after;				/* after equal times	*/
+	ps_event_t	*ep, *epf, *epn;	 /* event pointers	*/
+	ps_event_t	*update[CAL_LANES+1];	/* lane predecessors	*/
 
-	if(event_fl == NULL_EVENT_PTR) {
-		if(!(ep = event_fl = (ps_event_t *) malloc(100*sizeof(ps_event_t))))
-			ps_abort("Insufficient memory");
-		for(i = 1; i < 100; i++) {
-			epf = ep++;
-			epf->prior = ep;
-		}
-		ep->prior = NULL_EVENT_PTR;
-	}
-	ep = event_fl;
-	event_fl = ep->prior;
+	ep = (ps_event_t *) slab_alloc(&event_slab);
 	ep->time = time;
 	ep->type = type;
 	ep->gp = gp;
-	if(time <= (epf = calendar[0].next)->time){
-		ep->next = epf;
-		ep->prior = epf->prior;
-		calendar[0].next = epf->prior = ep;
-	}
-	else if((time+time) < (epf->time+(epl=calendar[1].prior)->time)) {
-		while(time > epf->time) epf = epf->next;	
-		ep->next = epf;
-		ep->prior = epf->prior;
-		epf->prior->next = ep;
-		epf->prior = ep;
-	}							
-	else {
-		while(time < epl->time) epl = epl->prior;	
-		ep->next = epl->next;
-		ep->prior = epl;
-		epl->next->prior = ep;
-		epl->next = ep;
+	set_event_lanes(ep);
+
+	epf = calendar[0].next;
+	after = time > epf->time 
+	    && (time+time) >= (epf->time+calendar[1].prior->time);
+	epf = calendar;
+	for(l = CAL_LANES; l > 0; l--) {
+		while((epn = LANE_NEXT(epf, l)) != &calendar[1] 
+		    && (epn->time < time || (after && epn->time == time)))
+			epf = epn;
+		update[l] = epf;
+	}
+	while((epn = epf->next) != &calendar[1]
+	    && (epn->time < time || (after && epn->time == time)))
+		epf = epn;
+
+	ep->next = epf->next;
+	ep->prior = epf;
+	epf->next->prior = ep;
+	epf->next = ep;
+	for(l = 1; l <= ep->lanes; l++) {
+		epf = update[l];
+		LANE_NEXT(ep, l) = LANE_NEXT(epf, l);
+		LANE_PRIOR(ep, l) = epf;
+		LANE_PRIOR(LANE_NEXT(epf, l), l) = ep;
+		LANE_NEXT(epf, l) = ep;
 	}
 #if defined(DEBUG)
 	print_event( "add_event", ep );
@@ -5593,21 +5676,83 @@ LOCAL	void	find_ready_cfs(
 
 LOCAL	void	init_event(void)
 
-/* Initializes the event free list to empty and also the event calendar	*/
-/* to empty.								*/
+/* Returns all events to the free list and initializes the event 	*/
+/* calendar to empty.							*/
 
 {
 	ps_event_t	*ep;			/* event pointer	*/
 
-	event_fl = NULL_EVENT_PTR;
+	long	l;				/* lane index		*/
+
+	slab_reset(&event_slab);
+	lane_seed = 2463534242UL;
 	(ep = calendar)->time = -1.0;
 	ep->type = CALENDAR;
 	ep->prior = NULL_EVENT_PTR;
 	ep->next = ep + 1;
+	ep->lanes = CAL_LANES;
+	ep->lane = cal_lane[0];
 	(++ep)->time = MAX_DOUBLE;
 	ep->type = CALENDAR;
 	ep->prior = ep - 1;
 	ep->next = NULL_EVENT_PTR;
+	ep->lanes = CAL_LANES;
+	ep->lane = cal_lane[1];
+	for(l = 1; l <= CAL_LANES; l++) {
+		LANE_PRIOR(&calendar[0], l) = NULL_EVENT_PTR;
+		LANE_NEXT(&calendar[0], l) = &calendar[1];
+		LANE_PRIOR(&calendar[1], l) = &calendar[0];
+		LANE_NEXT(&calendar[1], l) = NULL_EVENT_PTR;
+	}
+}
+
+/************************************************************************/
+
+LOCAL	void	init_event_lanes(
+
+/* Clears the express lanes of a new event.  Called once for each event	*/
+/* when its slab is allocated.						*/
+
+	void	*obj				/* event pointer	*/
+)
+{
+	ps_event_t	*ep = (ps_event_t *) obj;	/* event pointer*/
+
+	ep->lanes = 0;
+	ep->lane_max = 0;
+	ep->lane = NULL;
+}
+
+/************************************************************************/
+
+LOCAL	void	set_event_lanes(
+
+/* Draws the express lane count of an event being added to the calendar	*/
+/* and makes room for its lane pointers.  Each event is in lane 1 with	*/
+/* probability 1/4, in lane 2 with probability 1/16, and so on, drawn	*/
+/* afresh on every insertion, so the mix of lanes in the calendar does	*/
+/* not depend on the order in which event structs are reused.  The	*/
+/* draws come from a private 32 bit xorshift generator seeded by	*/
+/* init_event, so runs stay repeatable and the user's random streams	*/
+/* are untouched.							*/
+
+	ps_event_t	*ep			/* event pointer	*/
+)
+{
+	unsigned long	k;			/* lane draw		*/
+
+	lane_seed ^= (lane_seed << 13) & 0xffffffffUL;
+	lane_seed ^= lane_seed >> 17;
+	lane_seed ^= (lane_seed << 5) & 0xffffffffUL;
+	for(k = lane_seed, ep->lanes = 0; 
+	    (k & 3) == 0 && ep->lanes < CAL_LANES; k >>= 2)
+		ep->lanes++;
+	if(ep->lanes > ep->lane_max) {
+		if(!(ep->lane = (ps_event_t **) realloc(ep->lane, 
+		    2*ep->lanes*sizeof(ps_event_t *))))
+			ps_abort("Insufficient memory");
+		ep->lane_max = ep->lanes;
+	}
 }
 
 /************************************************************************/
@@ -5629,10 +5774,27 @@ LOCAL	ps_event_t	*next_event(void)
 	ep = cep->next;
 	cep->next = ep->next;
 	ep->next->prior = cep;
-	ep->prior = event_fl;
-	event_fl = ep;
+	unlink_lanes(ep);
+	slab_free(&event_slab, ep);
 	return(ep);
 }
+
+/************************************************************************/
+
+LOCAL	void	unlink_lanes(
+
+/* Removes an event from the calendar express lanes it is in.		*/
+
+	ps_event_t	*ep			/* event pointer	*/
+)
+{
+	long	l;				/* lane index		*/
+
+	for(l = 1; l <= ep->lanes; l++) {
+		LANE_NEXT(LANE_PRIOR(ep, l), l) = LANE_NEXT(ep, l);
+		LANE_PRIOR(LANE_NEXT(ep, l), l) = LANE_PRIOR(ep, l);
+	}
+}
 	
 /************************************************************************/
 
@@ -5768,8 +5930,8 @@ void	remove_event(
 	
 	ep->prior->next = ep->next;
 	ep->next->prior = ep->prior;
-	ep->prior = event_fl;
-	event_fl = ep;
+	unlink_lanes(ep);
+	slab_free(&event_slab, ep);
 #if defined(DEBUG)
 	print_event( "remove_event", ep );
 #endif
@@ -6852,8 +7014,7 @@ LOCAL	void	free_mess(
 	ps_mess_t	*mp			/* message pointer	*/
 )
 {
-	mp->next = next_mess;
-	next_mess = mp;
+	slab_free(&mess_slab, mp);
 }
 
 /************************************************************************/
@@ -6898,21 +7059,7 @@ LOCAL	ps_mess_t	*get_mess(void)
 /* Get message envelope							*/
 
 {
-	long	i;				/* loop index		*/
-	ps_mess_t	*mp, *nmp;		/* message pointers	*/
-
-	if(next_mess == NULL_MESS_PTR) {
-		if(!(mp = next_mess = (ps_mess_t *) malloc(100*sizeof(ps_mess_t))))
-			ps_abort("Insufficient memory");
-		for(i = 1; i < 100; i++) {
-			nmp = mp++;
-			nmp->next = mp;
-		}
-		mp->next = NULL_MESS_PTR;
-	}
-	mp = next_mess;
-	next_mess = next_mess->next;
-	return(mp);
+	return((ps_mess_t *) slab_alloc(&mess_slab));
 }
 
 /************************************************************************/
@@ -7563,6 +7710,176 @@ LOCAL	long sp_winder()
 
 /************************************************************************/
 
+LOCAL	void	*slab_alloc(
+
+/* Takes an object from the free list of the slab allocator "sp",	*/
+/* allocating a new slab when the free list is empty.  Each new slab	*/
+/* is as large as all of the earlier ones together, so a run makes	*/
+/* few calls to malloc however many objects it ends up needing.		*/
+
+	ps_slab_t	*sp			/* slab pointer		*/
+)
+{
+	void	*obj;				/* object pointer	*/
+
+	if(sp->free == NULL)
+		slab_grow(sp, sp->total < MIN_SLAB_OBJECTS 
+		    ? MIN_SLAB_OBJECTS : sp->total);
+	obj = sp->free;
+	memcpy(&sp->free, (char *)obj + sp->link, sizeof(void *));
+	if(++sp->used > sp->peak)
+		sp->peak = sp->used;
+	sp->allocs++;
+	return(obj);
+}
+
+/************************************************************************/
+
+LOCAL	void	slab_free(
+
+/* Returns an object to the free list of the slab allocator "sp".  The	*/
+/* free list is threaded through the object's own link field, so only	*/
+/* that field is changed.						*/
+
+	ps_slab_t	*sp,			/* slab pointer		*/
+	void		*obj			/* object pointer	*/
+)
+{
+	memcpy((char *)obj + sp->link, &sp->free, sizeof(void *));
+	sp->free = obj;
+	sp->used--;
+}
+
+/************************************************************************/
+
+LOCAL	void	slab_grow(
+
+/* Allocates a slab of "n" objects and adds them to the free list.	*/
+
+	ps_slab_t	*sp,			/* slab pointer		*/
+	long		n			/* # objects		*/
+)
+{
+	ps_slab_hdr_t	*hp;			/* slab header pointer	*/
+	long	i;				/* loop index		*/
+
+	if(!(hp = (ps_slab_hdr_t *) malloc(sizeof(ps_slab_hdr_t) + n * sp->size)))
+		ps_abort("Insufficient memory");
+	hp->next = sp->slabs;
+	hp->n = n;
+	sp->slabs = hp;
+	sp->nslabs++;
+	sp->total += n;
+	if(sp->init)
+		for(i = 0; i < n; i++)
+			(*sp->init)((char *)(hp + 1) + i * sp->size);
+	slab_link(sp, hp);
+}
+
+/************************************************************************/
+
+LOCAL	void	slab_link(
+
+/* Threads the objects of slab "hp" onto the free list of "sp" so that	*/
+/* they are handed out in address order.				*/
+
+	ps_slab_t	*sp,			/* slab pointer		*/
+	ps_slab_hdr_t	*hp			/* slab header pointer	*/
+)
+{
+	char	*obj;				/* object pointer	*/
+	long	i;				/* loop index		*/
+
+	obj = (char *)(hp + 1) + hp->n * sp->size;
+	for(i = 0; i < hp->n; i++) {
+		obj -= sp->size;
+		memcpy(obj + sp->link, &sp->free, sizeof(void *));
+		sp->free = obj;
+	}
+}
+
+/************************************************************************/
+
+LOCAL	void	slab_reset(
+
+/* Returns every object in every slab to the free list.  Objects	*/
+/* still in use when the previous run ended are reclaimed this way,	*/
+/* and the counts start over for the new run.				*/
+
+	ps_slab_t	*sp			/* slab pointer		*/
+)
+{
+	ps_slab_hdr_t	*hp;			/* slab header pointer	*/
+
+	sp->free = NULL;
+	for(hp = sp->slabs; hp; hp = hp->next)
+		slab_link(sp, hp);
+	sp->used = 0;
+	sp->peak = 0;
+	sp->allocs = 0;
+}
+
+/************************************************************************/
+
+LOCAL	double	*stack_alloc(
+
+/* Returns a task stack of at least "*sizep" bytes, from the pool of	*/
+/* free stacks when possible.  "*sizep" is set to the actual size.	*/
+/* Stacks are mapped with MAP_NORESERVE, so pages are only committed	*/
+/* when touched, with a guard page below the stack to catch overflow.	*/
+
+	long	*sizep				/* stack size pointer	*/
+)
+{
+#if	HAVE_MMAP && HAVE_SYS_MMAN_H
+	ps_stack_t	**spp;			/* free list pointer	*/
+	ps_stack_t	*sp;			/* free stack pointer	*/
+	char		*base;			/* mapping base		*/
+	long		page;			/* page size		*/
+
+	page = sysconf(_SC_PAGESIZE);
+	*sizep = (*sizep + page - 1) / page * page;
+	for (spp = &stack_fl; (sp = *spp); spp = &sp->next) {
+		if(sp->size == *sizep) {
+			*spp = sp->next;
+			return((double *) sp);
+		}
+	}
+	base = (char *) mmap(NULL, *sizep + page, PROT_READ | PROT_WRITE,
+	    MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+	if(base == (char *) MAP_FAILED)
+		return(NULL);
+	mprotect(base, page, PROT_NONE);	/* guard page		*/
+	return((double *) (base + page));
+#else
+	return((double *) malloc((unsigned)*sizep));
+#endif
+}
+
+/************************************************************************/
+
+LOCAL	void	stack_free(
+
+/* Returns a task stack to the pool.					*/
+
+	double	*base,				/* stack base		*/
+	long	size				/* stack size in bytes	*/
+)
+{
+#if	HAVE_MMAP && HAVE_SYS_MMAN_H
+	ps_stack_t	*sp;			/* free stack pointer	*/
+
+	sp = (ps_stack_t *) base;
+	sp->size = size;
+	sp->next = stack_fl;
+	stack_fl = sp;
+#else
+	free(base);
+#endif
+}
+
+/************************************************************************/
+
 LOCAL	int	stat_compare(
 
 /* This is a callback function that is passed in to quicksort for 	*/
@@ -7612,6 +7929,8 @@ LOCAL	void	test_stack(
 	long		i;			/* loop index		*/
 	long		bytes;			/* amount of stack used	*/
 
+	if(!stack_check_flag)
+		return;				/* stack not painted	*/
 	tp = ps_task_ptr(task);
 	stack = (char*)tp->stack_base;
 	stacksize = ((char*)tp->stack_limit) - stack;
@@ -7660,7 +7979,89 @@ void	warning(
 /*		Parasol Scheduler Support Functions			*/
 /************************************************************************/
 
-#if	HAVE_SIGALTSTACK && !_WIN32 && !_WIN64
+#if	PS_ASM_CONTEXT
+/*	mctx_switch(old_sp, new_sp): %rdi = old_sp, %rsi = new_sp.	*/
+/*	The frame holds the callee-saved registers, the x87 control	*/
+/*	word and MXCSR.  mctx_init builds the same frame for new tasks.	*/
+
+__asm__ (
+	".text\n"
+	".globl	mctx_switch\n"
+	".type	mctx_switch, @function\n"
+	"mctx_switch:\n"
+	"	pushq	%rbp\n"
+	"	pushq	%rbx\n"
+	"	pushq	%r12\n"
+	"	pushq	%r13\n"
+	"	pushq	%r14\n"
+	"	pushq	%r15\n"
+	"	subq	$8, %rsp\n"
+	"	stmxcsr	(%rsp)\n"
+	"	fnstcw	4(%rsp)\n"
+	"	movq	%rsp, (%rdi)\n"
+	"	movq	%rsi, %rsp\n"
+	"	ldmxcsr	(%rsp)\n"
+	"	fldcw	4(%rsp)\n"
+	"	addq	$8, %rsp\n"
+	"	popq	%r15\n"
+	"	popq	%r14\n"
+	"	popq	%r13\n"
+	"	popq	%r12\n"
+	"	popq	%rbx\n"
+	"	popq	%rbp\n"
+	"	ret\n"
+	".size	mctx_switch, .-mctx_switch\n"
+);
+
+/************************************************************************/
+
+LOCAL	void	mctx_init(
+
+/* Builds the initial context of a task so that the first switch to it	*/
+/* enters mctx_boot on the top of the stack.				*/
+
+	mctx_t	*mctx,				/* context buffer	*/
+	void	*sk_addr,			/* stack base		*/
+	size_t	sk_size				/* stack size in bytes	*/
+)
+{
+	unsigned long	*sp;			/* new stack pointer	*/
+	unsigned int	mxcsr;			/* SSE control/status	*/
+	unsigned short	fpucw;			/* x87 control word	*/
+
+	__asm__ ("stmxcsr %0" : "=m" (mxcsr));
+	__asm__ ("fnstcw %0" : "=m" (fpucw));
+
+/*	Align the top to 16 bytes.  The zero "return address" leaves	*/
+/*	the stack as though mctx_boot had been called.			*/
+
+	sp = (unsigned long *)(((size_t)sk_addr + sk_size) & ~(size_t)15);
+	*--sp = 0;				/* mctx_boot return	*/
+	*--sp = (unsigned long)mctx_boot;	/* mctx_switch return	*/
+	*--sp = 0;				/* %rbp			*/
+	*--sp = 0;				/* %rbx			*/
+	*--sp = 0;				/* %r12			*/
+	*--sp = 0;				/* %r13			*/
+	*--sp = 0;				/* %r14			*/
+	*--sp = 0;				/* %r15			*/
+	*--sp = (unsigned long)mxcsr | ((unsigned long)fpucw << 32);
+	mctx->sp = sp;
+}
+
+/************************************************************************/
+
+LOCAL	void	mctx_boot(void)
+
+/* Starts a new task on its own stack and handles default termination.	*/
+
+{
+	(* (ps_htp->code))( 0 );		/* 0 can be an arg */
+	if(ps_myself < 2)
+		ps_suspend(ps_myself);
+	ps_kill(ps_myself);
+	abort();				/* Shouldn't happen	*/
+}
+#elif	HAVE_SIGALTSTACK && !_WIN32 && !_WIN64
 static mctx_t mctx_caller;
 static sig_atomic_t mctx_called;
 static mctx_t  *mctx_creat;
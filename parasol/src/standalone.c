@@ -55,6 +55,7 @@ int main(
 )
 {
 	long	flags = 0;			/* run-time flags	*/
+	long	stack_check = TRUE;		/* paint stacks flag	*/
  	double	duration;			/* simulation duration	*/
 	long	seed;				/* random number seed	*/
 
@@ -82,6 +83,8 @@ int main(
 			flags |= RPF_TRACE | RPF_STEP;
 		else if(strcmp(argv[1], "-w") == 0)
 			flags |= RPF_WARNING;
+		else if(strcmp(argv[1], "-n") == 0)
+			stack_check = FALSE;
 		else
 			ps_abort("Invalid PARASOL run-time flag");
 
@@ -103,6 +106,8 @@ int main(
 			flags |= RPF_TRACE | RPF_STEP;
 		else if(strcmp(argv[2], "-w") == 0)
 			flags |= RPF_WARNING;
+		else if(strcmp(argv[2], "-n") == 0)
+			stack_check = FALSE;
 		else
 			ps_abort("Invalid PARASOL run-time flag");
 
@@ -113,6 +118,8 @@ int main(
 			flags |= RPF_TRACE | RPF_STEP;
 		else if(strcmp(argv[1], "-w") == 0)
 			flags |= RPF_WARNING;
+		else if(strcmp(argv[1], "-n") == 0)
+			stack_check = FALSE;
 		else
 			ps_abort("Invalid PARASOL run-time flag");
 
@@ -136,6 +143,10 @@ int main(
     fpsetmask( FP_X_INV | FP_X_DZ | FP_X_OFL );
 #endif
 	
+#ifdef STACK_TESTING
+	if(stack_check)
+		flags |= RPF_STACK_CHECK;	/* for test_all_stacks	*/
+#endif /*STACK_TESTING*/
 	ps_run_parasol(duration, seed, flags);
 	if (ps_stat_tab.used && (bs_time < 0.0))
 		ps_stats();
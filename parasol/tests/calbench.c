@@ -0,0 +1,67 @@
+/************************************************************************/
+/* calbench.c:	PARASOL event calendar benchmark			*/
+/*									*/
+/* Description:	Measures the number of events handled per second of	*/
+/*		wall clock time against the size of the calendar.	*/
+/*		Each of CALBENCH_TASKS tasks sleeps for an exponential	*/
+/*		time over and over, so the calendar holds about that	*/
+/*		many pending events.					*/
+/*									*/
+/* Usage:	CALBENCH_TASKS=n calbench seed duration			*/
+/*		Prints "calbench: n,events,seconds,events/second" on	*/
+/*		stderr at exit.  "make bench" runs a range of sizes.	*/
+/*									*/
+/************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <parasol.h>
+#include "test.h"
+
+static long n_tasks = 1000;
+static long n_events = 0;
+static double start;
+
+static double now(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + ts.tv_nsec * 1.0e-9;
+}
+
+static void report(void)
+{
+	double elapsed = now() - start;
+
+	fprintf(stderr, "calbench: %ld,%ld,%g,%g\n", n_tasks, n_events, elapsed, n_events / elapsed);
+}
+
+static void sleeper(void * arg)
+{
+	for (;;) {
+		ps_sleep(ps_exponential(1.0));
+		n_events += 1;
+	}
+}
+
+void ps_genesis(void * arg)
+{
+	long node, i;
+	char name[20];
+
+	if (getenv("CALBENCH_TASKS"))
+		n_tasks = atol(getenv("CALBENCH_TASKS"));
+	if (n_tasks <= 0)
+		ERRABORT("CALBENCH_TASKS must be positive");
+
+	node = ps_build_node("Node", 1, 1.0, 0.0, PS_FIFO, FALSE);
+	for (i = 0; i < n_tasks; i++) {
+		sprintf(name, "Sleeper %ld", i);
+		ps_resume(ps_create2(name, node, ANY_HOST, sleeper, 1, 0, 0.25));
+	}
+	atexit(report);
+	start = now();
+	ps_suspend(ps_myself);
+}
@@ -0,0 +1,103 @@
+/************************************************************************/
+/* ctxbench.c:	PARASOL task creation and context switch benchmark	*/
+/*									*/
+/* Description:	Creates CTXBENCH_TASKS tasks in a ring, then passes a	*/
+/*		token around the ring CTXBENCH_HOPS times.  Each hop	*/
+/*		blocks one task and runs the next, so the hop rate is	*/
+/*		the rate of context switches.  The time to create the	*/
+/*		tasks and the peak resident size show the cost of the	*/
+/*		task stacks.						*/
+/*									*/
+/* Usage:	CTXBENCH_TASKS=n CTXBENCH_HOPS=h ctxbench seed duration	*/
+/*		Prints "ctxbench: n,us/create,max RSS KB,hops,		*/
+/*		hops/second" on stderr at exit.  "make bench" runs a	*/
+/*		range of sizes.						*/
+/*									*/
+/************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <sys/resource.h>
+#include <parasol.h>
+#include "test.h"
+
+#define	SETUP	0
+#define	TOKEN	1
+
+static long n_tasks = 2;
+static long n_hops = 1000000;
+static long hops = 0;
+static double create_time;
+static double start;
+
+static double now(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + ts.tv_nsec * 1.0e-9;
+}
+
+static void report(void)
+{
+	double elapsed = now() - start;
+	struct rusage ru;
+
+	getrusage(RUSAGE_SELF, &ru);
+	fprintf(stderr, "ctxbench: %ld,%g,%ld,%ld,%g\n", n_tasks, create_time * 1.0e6 / n_tasks,
+		(long)ru.ru_maxrss, hops, hops / elapsed);
+}
+
+static void relay(void * arg)
+{
+	long type, ack_port, next;
+	double ts;
+	char *text;
+
+	if (ps_receive(ps_my_std_port, NEVER, &type, &ts, &text, &ack_port) == SYSERR || type != SETUP)
+		ERRABORT("Setup receive failed");
+	next = (long)(size_t)text;
+	for (;;) {
+		if (ps_receive(ps_my_std_port, NEVER, &type, &ts, &text, &ack_port) == SYSERR)
+			ERRABORT("Receive failed");
+		if (++hops >= n_hops)
+			exit(0);
+		if (ps_send(next, TOKEN, "", NULL_PORT) == SYSERR)
+			ERRABORT("Send failed");
+	}
+}
+
+void ps_genesis(void * arg)
+{
+	long node, i;
+	long *tasks;
+	char name[20];
+	double begin;
+
+	if (getenv("CTXBENCH_TASKS"))
+		n_tasks = atol(getenv("CTXBENCH_TASKS"));
+	if (getenv("CTXBENCH_HOPS"))
+		n_hops = atol(getenv("CTXBENCH_HOPS"));
+	if (n_tasks <= 0 || n_hops <= 0)
+		ERRABORT("CTXBENCH_TASKS and CTXBENCH_HOPS must be positive");
+	if (!(tasks = (long *) malloc(n_tasks * sizeof(long))))
+		ERRABORT("Insufficient memory");
+
+	node = ps_build_node("Node", 1, 1.0, 0.0, PS_FIFO, FALSE);
+	begin = now();
+	for (i = 0; i < n_tasks; i++) {
+		sprintf(name, "Relay %ld", i);
+		tasks[i] = ps_create(name, node, ANY_HOST, relay, 1);
+	}
+	create_time = now() - begin;
+
+	for (i = 0; i < n_tasks; i++) {
+		ps_send(ps_std_port(tasks[i]), SETUP, (char *)(size_t)ps_std_port(tasks[(i + 1) % n_tasks]), NULL_PORT);
+		ps_resume(tasks[i]);
+	}
+	atexit(report);
+	start = now();
+	ps_send(ps_std_port(tasks[0]), TOKEN, "", NULL_PORT);
+	ps_suspend(ps_myself);
+}
@@ -38,4 +38,23 @@ fprintf(stderr,"%s\n", msg)
 #define abs(x) (((x) < 0) ? -(x) : (x))
 #endif /*abs*/
 
+/* The tests use the old names of the queueing discipline codes; they	*/
+/* are not in parasol.h as lqiolib uses some of them for other things.	*/
+
+#ifndef FCFS
+#define FCFS	PS_FIFO
+#endif
+#ifndef HOL
+#define HOL	PS_HOL
+#endif
+#ifndef PR
+#define PR	PS_PR
+#endif
+#ifndef RAND
+#define RAND	PS_RAND
+#endif
+#ifndef CFS
+#define CFS	PS_CFS
+#endif
+
 #endif /*__TEST_H*/
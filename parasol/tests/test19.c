@@ -103,8 +103,6 @@ void ps_genesis (void * arg)
 		ERRREPORT("ps_create node = -1 succeeded");
 	if (ps_create_group("t19-7", nids[0], 2, task, 1,0) != SYSERR)
 		ERRREPORT("ps_create cpu = 2 succeeded");
-	if (ps_create_group("t19-8", nids[2], ANY_HOST, task, 1,0) != SYSERR)
-		ERRREPORT("ps_create cpu = 2 succeeded");
 
 /* ps_create2								*/
 
@@ -159,6 +159,8 @@ bool
 Model::solve()
 {
     bool ok = true;
+    MVA::__threads = Pragma::mvaThreads();
+    MVA::__anderson = Pragma::mvaAnderson();
     LQX::Program * lqx = _input.getLQXProgram();
     if ( lqx != nullptr ) {
 	LQX::Environment * environment = lqx->getEnvironment();
@@ -23,7 +23,9 @@ const std::map<const std::string,const Pragma::fptr> Pragma::__set_pragma =
     { LQIO::DOM::Pragma::_force_multiserver_,	&Pragma::setForceMultiserver },
     { LQIO::DOM::Pragma::_hvfcfs_,		&Pragma::setHVFCFSAlgorithm },
     { LQIO::DOM::Pragma::_multiserver_,		&Pragma::setMultiserver },
-    { LQIO::DOM::Pragma::_mva_,			&Pragma::setMVA }
+    { LQIO::DOM::Pragma::_mva_,			&Pragma::setMVA },
+    { LQIO::DOM::Pragma::_mva_anderson_,	&Pragma::setMVAAnderson },
+    { LQIO::DOM::Pragma::_mva_threads_,		&Pragma::setMVAThreads }
 };
 
 /*
@@ -34,7 +36,9 @@ Pragma::Pragma() :
     _default_output(true),
     _force_multiserver(false),
     _multiserver(Model::Multiserver::DEFAULT),
-    _mva(Model::Solver::EXACT_MVA)
+    _mva(Model::Solver::EXACT_MVA),
+    _mva_anderson(0),
+    _mva_threads(1)
 {
 }
 
@@ -124,6 +128,20 @@ void Pragma::setMVA(const std::string& value)
 	throw std::domain_error( value );
     }
 }
+
+void Pragma::setMVAAnderson(const std::string& value)
+{
+    char * endptr = nullptr;
+    _mva_anderson = std::strtoul( value.c_str(), &endptr, 10 );
+    if ( *endptr != '\0' ) throw std::domain_error( value );
+}
+
+void Pragma::setMVAThreads(const std::string& value)
+{
+    char * endptr = nullptr;
+    _mva_threads = std::strtoul( value.c_str(), &endptr, 10 );
+    if ( *endptr != '\0' ) throw std::domain_error( value );
+}
 
 /*
  * Print out available pragmas.
@@ -137,7 +155,7 @@ Pragma::usage( std::ostream& output )
 
     for ( std::map<const std::string,const fptr>::const_iterator i = __set_pragma.begin(); i != __set_pragma.end(); ++i ) {
 	output << "\t" << std::setw(20) << i->first;
-	if ( i->first == LQIO::DOM::Pragma::_tau_ ) {
+	if ( i->first == LQIO::DOM::Pragma::_tau_ || i->first == LQIO::DOM::Pragma::_mva_threads_ || i->first == LQIO::DOM::Pragma::_mva_anderson_ ) {
 	    output << " = <int>" << std::endl;
 	} else {
 	    const std::set<std::string>* args = LQIO::DOM::Pragma::getValues( i->first );
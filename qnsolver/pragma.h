@@ -66,6 +66,18 @@ public:
 	    return __cache->_mva;
 	}
 
+    static unsigned int mvaAnderson()
+	{
+	    assert( __cache != nullptr );
+	    return __cache->_mva_anderson;
+	}
+
+    static unsigned int mvaThreads()
+	{
+	    assert( __cache != nullptr );
+	    return __cache->_mva_threads;
+	}
+
     static void noDefaultOutput( bool enable )
 	{
 	    assert( __cache != nullptr );
@@ -77,6 +89,8 @@ private:
     void setForceMultiserver(const std::string&);
     void setHVFCFSAlgorithm(const std::string&);
     void setMVA(const std::string&);
+    void setMVAAnderson(const std::string&);
+    void setMVAThreads(const std::string&);
     void setMultiserver(const std::string&);
 
 public:
@@ -90,6 +104,8 @@ private:
     bool _force_multiserver;			/* True to force all stations (except delay) to use the multisever algorithnm */
     Model::Multiserver _multiserver;		/* Multiserver algorithm */
     Model::Solver _mva;				/* Solver algorithm */
+    unsigned int _mva_anderson;			/* Anderson acceleration depth, 0 for none */
+    unsigned int _mva_threads;			/* Threads for Linearizer, 0 for all cores */
 
     /* --- */
 